@@ -24,6 +24,9 @@ extern "C" {
 typedef int (*acb_calc_func_t)(acb_ptr out,
     const acb_t inp, void * param, slong order, slong prec);
 
+typedef int (*acb_calc_batch_func_t)(acb_ptr out,
+    acb_srcptr inp, slong len, void * param, slong order, slong prec);
+
 /* Integration (old) */
 
 void acb_calc_cauchy_bound(arb_t bound, acb_calc_func_t func,
@@ -46,6 +49,9 @@ typedef struct
     slong depth_limit;
     int use_heap;
     int verbose;
+    slong num_threads;
+    int deterministic;
+    acb_calc_batch_func_t batch_func;
 }
 acb_calc_integrate_opt_struct;
 
@@ -60,12 +66,42 @@ acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
     const acb_calc_integrate_opt_t options,
     slong prec);
 
+int
+acb_calc_integrate_de(acb_t res, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b,
+    slong goal, const mag_t tol,
+    const acb_calc_integrate_opt_t options,
+    slong prec);
+
+int
+acb_calc_integrate_de_growth(acb_t res, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b,
+    const mag_t ca, const arb_t alpha_a,
+    const mag_t cb, const arb_t alpha_b,
+    slong goal, const mag_t tol,
+    const acb_calc_integrate_opt_t options,
+    slong prec);
+
 int
 acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
     acb_calc_func_t f, void * param,
     const acb_t a, const acb_t b, const mag_t tol,
     slong deg_limit, int verbose, slong prec);
 
+int
+acb_calc_integrate_gl_auto_deg_batch(acb_t res, slong * eval_count,
+    acb_calc_func_t f, acb_calc_batch_func_t fbatch, void * param,
+    const acb_t a, const acb_t b, const mag_t tol,
+    slong deg_limit, int verbose, slong prec);
+
+void acb_calc_gl_cache_prewarm(slong deg_limit, slong prec);
+
+void acb_calc_gl_cache_set_limit(slong bytes);
+
+slong acb_calc_gl_cache_allocated_bytes(void);
+
+void acb_calc_gl_cache_clear(void);
+
 #ifdef __cplusplus
 }
 #endif
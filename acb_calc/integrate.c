@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "acb_calc.h"
 
 static void
@@ -104,6 +105,568 @@ _acb_overlaps(acb_t tmp, const acb_t a, const acb_t b, slong prec)
     return acb_contains_zero(tmp);
 }
 
+static void
+integrate_limits(slong * depth_limit, slong * eval_limit, slong * deg_limit,
+    slong * goal, const acb_calc_integrate_opt_t options, slong prec)
+{
+    *depth_limit = options->depth_limit;
+    if (*depth_limit <= 0)
+        *depth_limit = 2 * prec;
+    *depth_limit = FLINT_MAX(*depth_limit, 1);
+
+    *eval_limit = options->eval_limit;
+    if (*eval_limit <= 0)
+        *eval_limit = 1000 * prec + prec * prec;
+    *eval_limit = FLINT_MAX(*eval_limit, 1);
+
+    *goal = FLINT_MAX(*goal, 0);
+    *deg_limit = options->deg_limit;
+    if (*deg_limit <= 0)
+        *deg_limit = 0.5 * FLINT_MIN(*goal, prec) + 60;
+}
+
+/*
+    Parallel version. The subintervals waiting to be processed are kept
+    in the same stack or heap as in the serial code, protected by a mutex.
+    A subinterval is taken from the top, processed (tested for
+    convergence, integrated with Gauss-Legendre or bisected) without
+    holding the lock, and the outcome is then applied to the shared state.
+
+    By default, each thread takes a new subinterval as soon as it is done
+    with the previous one; the enclosure is then valid but can depend on
+    the timing of the threads. In deterministic mode, the work is instead
+    done in rounds: up to num_threads subintervals are taken from the top,
+    processed in parallel with the same tolerance, and their outcomes are
+    applied in a fixed order, so that the result only depends on the
+    options and not on the scheduling. The same worker threads are used
+    for all rounds.
+*/
+
+#define ITEM_LEAF 0
+#define ITEM_GL 1
+#define ITEM_SPLIT 2
+
+typedef struct
+{
+    acb_struct a[2];
+    acb_struct b[2];
+    acb_struct v[2];
+    mag_struct m[2];
+    acb_t u;
+    mag_t tol;
+    slong feval;
+    int stopping;
+    int kind;
+}
+integrate_item_struct;
+
+typedef struct
+{
+    acb_calc_func_t f;
+    acb_calc_batch_func_t batch_func;
+    void * param;
+    slong goal;
+    slong deg_limit;
+    slong depth_limit;
+    slong eval_limit;
+    int use_heap;
+    int verbose;
+    slong prec;
+
+    acb_ptr as;
+    acb_ptr bs;
+    acb_ptr vs;
+    mag_ptr ms;
+    slong alloc;
+    slong depth;
+    slong depth_max;
+    slong active;
+
+    acb_t s;
+    mag_t new_tol;
+    slong eval;
+    slong leaf_interval_count;
+    int stopping;
+    int status;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+}
+integrate_state_struct;
+
+static void
+integrate_item_init(integrate_item_struct * item)
+{
+    slong i;
+
+    for (i = 0; i < 2; i++)
+    {
+        acb_init(item->a + i);
+        acb_init(item->b + i);
+        acb_init(item->v + i);
+        mag_init(item->m + i);
+    }
+
+    acb_init(item->u);
+    mag_init(item->tol);
+}
+
+static void
+integrate_item_clear(integrate_item_struct * item)
+{
+    slong i;
+
+    for (i = 0; i < 2; i++)
+    {
+        acb_clear(item->a + i);
+        acb_clear(item->b + i);
+        acb_clear(item->v + i);
+        mag_clear(item->m + i);
+    }
+
+    acb_clear(item->u);
+    mag_clear(item->tol);
+}
+
+/* Moves the top subinterval of the stack (or heap) into item. */
+static void
+integrate_pop(integrate_state_struct * S, integrate_item_struct * item)
+{
+    slong top;
+
+    if (S->stopping == 0 && S->eval >= S->eval_limit - 1)
+    {
+        if (S->verbose > 0)
+            flint_printf("stopping at eval_limit %wd\n", S->eval_limit);
+        S->status = ARB_CALC_NO_CONVERGENCE;
+        S->stopping = 1;
+    }
+
+    top = S->use_heap ? 0 : S->depth - 1;
+
+    acb_swap(item->a, S->as + top);
+    acb_swap(item->b, S->bs + top);
+    acb_swap(item->v, S->vs + top);
+    mag_swap(item->m, S->ms + top);
+
+    mag_set(item->tol, S->new_tol);
+    item->stopping = S->stopping;
+
+    S->depth--;
+    if (S->use_heap && S->depth > 0)
+    {
+        acb_swap(S->as, S->as + S->depth);
+        acb_swap(S->bs, S->bs + S->depth);
+        acb_swap(S->vs, S->vs + S->depth);
+        mag_swap(S->ms, S->ms + S->depth);
+        heap_up(S->as, S->bs, S->vs, S->ms, S->depth);
+    }
+}
+
+/* Moves subinterval i of item onto the stack (or heap). */
+static void
+integrate_push(integrate_state_struct * S, integrate_item_struct * item, slong i)
+{
+    slong k;
+
+    if (S->depth >= S->alloc)
+    {
+        S->as = flint_realloc(S->as, 2 * S->alloc * sizeof(acb_struct));
+        S->bs = flint_realloc(S->bs, 2 * S->alloc * sizeof(acb_struct));
+        S->vs = flint_realloc(S->vs, 2 * S->alloc * sizeof(acb_struct));
+        S->ms = flint_realloc(S->ms, 2 * S->alloc * sizeof(mag_struct));
+        for (k = S->alloc; k < 2 * S->alloc; k++)
+        {
+            acb_init(S->as + k);
+            acb_init(S->bs + k);
+            acb_init(S->vs + k);
+            mag_init(S->ms + k);
+        }
+        S->alloc *= 2;
+    }
+
+    acb_swap(S->as + S->depth, item->a + i);
+    acb_swap(S->bs + S->depth, item->b + i);
+    acb_swap(S->vs + S->depth, item->v + i);
+    mag_swap(S->ms + S->depth, item->m + i);
+
+    S->depth++;
+    S->depth_max = FLINT_MAX(S->depth_max, S->depth);
+
+    if (S->use_heap)
+        heap_down(S->as, S->bs, S->vs, S->ms, S->depth);
+}
+
+static void
+integrate_update_tol(integrate_state_struct * S, const acb_t v)
+{
+    mag_t t;
+    mag_init(t);
+    acb_get_mag_lower(t, v);
+    mag_mul_2exp_si(t, t, -S->goal);
+    mag_max(S->new_tol, S->new_tol, t);
+    mag_clear(t);
+}
+
+/* Processes a subinterval; does not touch the shared state. */
+static void
+integrate_process(integrate_item_struct * item, const integrate_state_struct * S)
+{
+    slong prec = S->prec;
+    int gl_status;
+
+    item->feval = 0;
+
+    /* We are done with this subinterval. */
+    if (mag_cmp(item->m, item->tol) < 0 ||
+        _acb_overlaps(item->u, item->a, item->b, prec) || item->stopping)
+    {
+        acb_set(item->u, item->v);
+        item->kind = ITEM_LEAF;
+        return;
+    }
+
+    /* Attempt using Gauss-Legendre rule. */
+    if (acb_is_finite(item->v))
+    {
+        gl_status = acb_calc_integrate_gl_auto_deg_batch(item->u, &item->feval,
+            S->f, S->batch_func, S->param, item->a, item->b, item->tol,
+            S->deg_limit, S->verbose > 1, prec);
+
+        if (gl_status == ARB_CALC_SUCCESS)
+        {
+            /* We know that the result is real. */
+            if (acb_is_real(item->v))
+                arb_zero(acb_imagref(item->u));
+
+            item->kind = ITEM_GL;
+            return;
+        }
+    }
+
+    /* Bisection; keep the crude estimate in case the depth limit is hit. */
+    acb_set(item->u, item->v);
+
+    acb_set(item->b + 1, item->b);
+    acb_add(item->a + 1, item->a, item->b, prec);
+    acb_mul_2exp_si(item->a + 1, item->a + 1, -1);
+    acb_set(item->b, item->a + 1);
+
+    quad_simple(item->v, S->f, S->param, item->a, item->b, prec);
+    mag_hypot(item->m, arb_radref(acb_realref(item->v)), arb_radref(acb_imagref(item->v)));
+    quad_simple(item->v + 1, S->f, S->param, item->a + 1, item->b + 1, prec);
+    mag_hypot(item->m + 1, arb_radref(acb_realref(item->v + 1)), arb_radref(acb_imagref(item->v + 1)));
+
+    item->feval += 2;
+    item->kind = ITEM_SPLIT;
+}
+
+/* Applies the outcome of integrate_process to the shared state. */
+static void
+integrate_apply(integrate_state_struct * S, integrate_item_struct * item)
+{
+    S->eval += item->feval;
+
+    if (item->kind == ITEM_SPLIT && S->depth + 1 >= S->depth_limit - 1)
+    {
+        if (S->verbose > 0 && !S->stopping)
+            flint_printf("stopping at depth_limit %wd\n", S->depth_limit);
+        S->status = ARB_CALC_NO_CONVERGENCE;
+        S->stopping = 1;
+        item->kind = ITEM_LEAF;
+    }
+
+    if (item->kind == ITEM_SPLIT)
+    {
+        integrate_update_tol(S, item->v);
+        integrate_update_tol(S, item->v + 1);
+
+        /* Make the interval with the larger error the priority. */
+        if (mag_cmp(item->m, item->m + 1) < 0)
+        {
+            integrate_push(S, item, 0);
+            integrate_push(S, item, 1);
+        }
+        else
+        {
+            integrate_push(S, item, 1);
+            integrate_push(S, item, 0);
+        }
+    }
+    else
+    {
+        acb_add(S->s, S->s, item->u, S->prec);
+        S->leaf_interval_count++;
+
+        /* Adjust absolute tolerance based on new information. */
+        if (item->kind == ITEM_GL)
+            integrate_update_tol(S, item->u);
+    }
+}
+
+static void *
+integrate_worker(void * arg_ptr)
+{
+    integrate_state_struct * S = (integrate_state_struct *) arg_ptr;
+    integrate_item_struct item;
+
+    integrate_item_init(&item);
+
+    pthread_mutex_lock(&S->mutex);
+
+    for (;;)
+    {
+        while (S->depth == 0 && S->active > 0)
+            pthread_cond_wait(&S->cond, &S->mutex);
+
+        if (S->depth == 0)
+            break;
+
+        integrate_pop(S, &item);
+        S->active++;
+        pthread_mutex_unlock(&S->mutex);
+
+        integrate_process(&item, S);
+
+        pthread_mutex_lock(&S->mutex);
+        integrate_apply(S, &item);
+        S->active--;
+        pthread_cond_broadcast(&S->cond);
+    }
+
+    pthread_cond_broadcast(&S->cond);
+    pthread_mutex_unlock(&S->mutex);
+
+    integrate_item_clear(&item);
+
+    return NULL;
+}
+
+static void *
+integrate_thread(void * arg_ptr)
+{
+    integrate_worker(arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+/* Worker pool for deterministic mode; the threads are created once
+   and process one item per round. */
+typedef struct
+{
+    const integrate_state_struct * S;
+    integrate_item_struct * items;
+    slong num;
+    slong round;
+    slong done;
+    int quit;
+    pthread_mutex_t mutex;
+    pthread_cond_t start;
+    pthread_cond_t finish;
+}
+integrate_pool_struct;
+
+typedef struct
+{
+    integrate_pool_struct * pool;
+    slong index;
+}
+integrate_round_arg_t;
+
+static void *
+integrate_round_thread(void * arg_ptr)
+{
+    integrate_round_arg_t arg = *((integrate_round_arg_t *) arg_ptr);
+    integrate_pool_struct * pool = arg.pool;
+    slong seen = 0;
+
+    pthread_mutex_lock(&pool->mutex);
+
+    for (;;)
+    {
+        while (pool->round == seen && !pool->quit)
+            pthread_cond_wait(&pool->start, &pool->mutex);
+
+        if (pool->quit)
+            break;
+
+        seen = pool->round;
+
+        if (arg.index < pool->num)
+        {
+            pthread_mutex_unlock(&pool->mutex);
+            integrate_process(pool->items + arg.index, pool->S);
+            pthread_mutex_lock(&pool->mutex);
+
+            pool->done++;
+            pthread_cond_signal(&pool->finish);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static int
+_acb_calc_integrate_threaded(acb_t res, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b, slong goal, const mag_t tol,
+    const acb_calc_integrate_opt_t options, slong num_threads, slong prec)
+{
+    integrate_state_struct S[1];
+    pthread_t * threads;
+    slong i;
+
+    S->f = f;
+    S->batch_func = options->batch_func;
+    S->param = param;
+    S->prec = prec;
+    S->use_heap = options->use_heap;
+    S->verbose = options->verbose;
+    integrate_limits(&S->depth_limit, &S->eval_limit, &S->deg_limit,
+        &goal, options, prec);
+    S->goal = goal;
+
+    S->alloc = 4;
+    S->as = _acb_vec_init(S->alloc);
+    S->bs = _acb_vec_init(S->alloc);
+    S->vs = _acb_vec_init(S->alloc);
+    S->ms = _mag_vec_init(S->alloc);
+    acb_init(S->s);
+    mag_init(S->new_tol);
+
+    S->status = ARB_CALC_SUCCESS;
+    S->stopping = 0;
+    S->leaf_interval_count = 0;
+    S->active = 0;
+
+    /* Compute initial crude estimate for the whole interval. */
+    acb_set(S->as, a);
+    acb_set(S->bs, b);
+    quad_simple(S->vs, f, param, S->as, S->bs, prec);
+    mag_hypot(S->ms, arb_radref(acb_realref(S->vs)), arb_radref(acb_imagref(S->vs)));
+    S->depth = S->depth_max = 1;
+    S->eval = 1;
+
+    /* Adjust absolute tolerance based on new information. */
+    acb_get_mag_lower(S->new_tol, S->vs);
+    mag_mul_2exp_si(S->new_tol, S->new_tol, -goal);
+    mag_max(S->new_tol, tol, S->new_tol);
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    if (options->deterministic)
+    {
+        integrate_item_struct * items;
+        integrate_round_arg_t * args;
+        integrate_pool_struct pool[1];
+        slong num;
+
+        items = flint_malloc(sizeof(integrate_item_struct) * num_threads);
+        args = flint_malloc(sizeof(integrate_round_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+            integrate_item_init(items + i);
+
+        pool->S = S;
+        pool->items = items;
+        pool->num = 0;
+        pool->round = 0;
+        pool->done = 0;
+        pool->quit = 0;
+        pthread_mutex_init(&pool->mutex, NULL);
+        pthread_cond_init(&pool->start, NULL);
+        pthread_cond_init(&pool->finish, NULL);
+
+        for (i = 1; i < num_threads; i++)
+        {
+            args[i].pool = pool;
+            args[i].index = i;
+            pthread_create(&threads[i], NULL, integrate_round_thread, &args[i]);
+        }
+
+        while (S->depth > 0)
+        {
+            num = FLINT_MIN(S->depth, num_threads);
+
+            for (i = 0; i < num; i++)
+                integrate_pop(S, items + i);
+
+            pthread_mutex_lock(&pool->mutex);
+            pool->num = num;
+            pool->done = 0;
+            pool->round++;
+            pthread_cond_broadcast(&pool->start);
+            pthread_mutex_unlock(&pool->mutex);
+
+            integrate_process(items, S);
+
+            pthread_mutex_lock(&pool->mutex);
+            while (pool->done < num - 1)
+                pthread_cond_wait(&pool->finish, &pool->mutex);
+            pthread_mutex_unlock(&pool->mutex);
+
+            for (i = 0; i < num; i++)
+                integrate_apply(S, items + i);
+        }
+
+        pthread_mutex_lock(&pool->mutex);
+        pool->quit = 1;
+        pthread_cond_broadcast(&pool->start);
+        pthread_mutex_unlock(&pool->mutex);
+
+        for (i = 1; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        pthread_mutex_destroy(&pool->mutex);
+        pthread_cond_destroy(&pool->start);
+        pthread_cond_destroy(&pool->finish);
+
+        for (i = 0; i < num_threads; i++)
+            integrate_item_clear(items + i);
+
+        flint_free(items);
+        flint_free(args);
+    }
+    else
+    {
+        pthread_mutex_init(&S->mutex, NULL);
+        pthread_cond_init(&S->cond, NULL);
+
+        for (i = 1; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, integrate_thread, S);
+
+        integrate_worker(S);
+
+        for (i = 1; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        pthread_mutex_destroy(&S->mutex);
+        pthread_cond_destroy(&S->cond);
+    }
+
+    flint_free(threads);
+
+    if (S->verbose > 0)
+    {
+        flint_printf("depth %wd/%wd, eval %wd/%wd, %wd leaf intervals\n",
+            S->depth_max, S->depth_limit, S->eval, S->eval_limit,
+            S->leaf_interval_count);
+    }
+
+    acb_set(res, S->s);
+
+    _acb_vec_clear(S->as, S->alloc);
+    _acb_vec_clear(S->bs, S->alloc);
+    _acb_vec_clear(S->vs, S->alloc);
+    _mag_vec_clear(S->ms, S->alloc);
+    acb_clear(S->s);
+    mag_clear(S->new_tol);
+
+    return S->status;
+}
+
 int
 acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
     const acb_t a, const acb_t b,
@@ -117,7 +680,7 @@ acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
     mag_t tmpm, tmpn, new_tol;
     slong depth_limit, eval_limit, deg_limit;
     slong depth, depth_max, eval, feval, top;
-    slong leaf_interval_count;
+    slong leaf_interval_count, num_threads;
     slong alloc;
     int stopping, real_error, use_heap, status, gl_status, verbose;
 
@@ -128,6 +691,14 @@ acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
         return acb_calc_integrate(res, f, param, a, b, goal, tol, opt, prec);
     }
 
+    num_threads = options->num_threads;
+    if (num_threads < 0)
+        num_threads = flint_get_num_threads();
+
+    if (num_threads > 1)
+        return _acb_calc_integrate_threaded(res, f, param, a, b, goal, tol,
+            options, num_threads, prec);
+
     status = ARB_CALC_SUCCESS;
 
     acb_init(s);
@@ -137,20 +708,7 @@ acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
     mag_init(tmpn);
     mag_init(new_tol);
 
-    depth_limit = options->depth_limit;
-    if (depth_limit <= 0)
-        depth_limit = 2 * prec;
-    depth_limit = FLINT_MAX(depth_limit, 1);
-
-    eval_limit = options->eval_limit;
-    if (eval_limit <= 0)
-        eval_limit = 1000 * prec + prec * prec;
-    eval_limit = FLINT_MAX(eval_limit, 1);
-
-    goal = FLINT_MAX(goal, 0);
-    deg_limit = options->deg_limit;
-    if (deg_limit <= 0)
-        deg_limit = 0.5 * FLINT_MIN(goal, prec) + 60;
+    integrate_limits(&depth_limit, &eval_limit, &deg_limit, &goal, options, prec);
 
     verbose = options->verbose;
     use_heap = options->use_heap;
@@ -217,7 +775,8 @@ acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
         /* Attempt using Gauss-Legendre rule. */
         if (acb_is_finite(vs + top))
         {
-            gl_status = acb_calc_integrate_gl_auto_deg(u, &feval, f, param,
+            gl_status = acb_calc_integrate_gl_auto_deg_batch(u, &feval,
+                f, options->batch_func, param,
                 as + top, bs + top, new_tol, deg_limit, verbose > 1, prec);
             eval += feval;
 
@@ -0,0 +1,530 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_calc.h"
+
+#define DE_TANH_SINH      0     /* [a, b] */
+#define DE_EXP_SINH_RIGHT 1     /* [a, +inf) */
+#define DE_EXP_SINH_LEFT  2     /* (-inf, b] */
+#define DE_SINH_SINH      3     /* (-inf, +inf) */
+
+typedef struct
+{
+    acb_calc_func_t f;
+    void * param;
+    int kind;
+    acb_srcptr a;
+    acb_srcptr b;
+    acb_srcptr mid;
+    acb_srcptr delta;
+}
+de_param_struct;
+
+/*
+    With u = pi/2 sinh(t), the path is parametrized by
+
+        tanh-sinh:  x = mid + delta tanh(u),
+        exp-sinh:   x = a + exp(u)  or  x = b - exp(u),
+        sinh-sinh:  x = sinh(u),
+
+    and the integrand in the t variable is g(t) = f(x(t)) |x'(t)|
+    (with the orientation of the original path), which decays double
+    exponentially as t -> +/- inf.
+
+    For tanh-sinh, x is computed close to the endpoints from
+    1 - tanh(u) = 2/(exp(2u)+1) to avoid cancellation in the distance
+    to the endpoint.
+*/
+static int
+de_func(acb_ptr res, const acb_t t, void * param, slong order, slong prec)
+{
+    de_param_struct * p = (de_param_struct *) param;
+    acb_t u, v, x;
+
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_init(u);
+    acb_init(v);
+    acb_init(x);
+
+    /* u = pi/2 sinh(t) */
+    acb_sinh(u, t, prec);
+    acb_const_pi(v, prec);
+    acb_mul(u, u, v, prec);
+    acb_mul_2exp_si(u, u, -1);
+
+    if (p->kind == DE_TANH_SINH)
+    {
+        if (arb_is_positive(acb_realref(u)))
+        {
+            /* x = b - delta 2/(exp(2u)+1) */
+            acb_mul_2exp_si(v, u, 1);
+            acb_exp(v, v, prec);
+            acb_add_ui(v, v, 1, prec);
+            acb_inv(v, v, prec);
+            acb_mul_2exp_si(v, v, 1);
+            acb_mul(v, v, p->delta, prec);
+            acb_sub(x, p->b, v, prec);
+        }
+        else if (arb_is_negative(acb_realref(u)))
+        {
+            /* x = a + delta 2/(exp(-2u)+1) */
+            acb_mul_2exp_si(v, u, 1);
+            acb_neg(v, v);
+            acb_exp(v, v, prec);
+            acb_add_ui(v, v, 1, prec);
+            acb_inv(v, v, prec);
+            acb_mul_2exp_si(v, v, 1);
+            acb_mul(v, v, p->delta, prec);
+            acb_add(x, p->a, v, prec);
+        }
+        else
+        {
+            acb_tanh(v, u, prec);
+            acb_mul(v, v, p->delta, prec);
+            acb_add(x, p->mid, v, prec);
+        }
+
+        p->f(res, x, p->param, order, prec);
+
+        /* v = delta / cosh(u)^2 */
+        acb_cosh(u, u, prec);
+        acb_mul(u, u, u, prec);
+        acb_div(v, p->delta, u, prec);
+    }
+    else if (p->kind == DE_SINH_SINH)
+    {
+        acb_sinh_cosh(x, v, u, prec);
+        p->f(res, x, p->param, order, prec);
+    }
+    else
+    {
+        acb_exp(v, u, prec);
+
+        if (p->kind == DE_EXP_SINH_RIGHT)
+            acb_add(x, p->a, v, prec);
+        else
+            acb_sub(x, p->b, v, prec);
+
+        p->f(res, x, p->param, order, prec);
+    }
+
+    /* multiply by v pi/2 cosh(t) */
+    acb_cosh(u, t, prec);
+    acb_mul(v, v, u, prec);
+    acb_const_pi(u, prec);
+    acb_mul(v, v, u, prec);
+    acb_mul_2exp_si(v, v, -1);
+    acb_mul(res, res, v, prec);
+
+    acb_clear(u);
+    acb_clear(v);
+    acb_clear(x);
+
+    return 0;
+}
+
+/*
+    Bounds |int_{e - delta w}^{e} f(x) dx| (sign = 1) or
+    |int_{e}^{e + delta w} f(x) dx| (sign = -1) by
+    |delta| w sup |f| over the segment. This requires f to be
+    bounded up to the endpoint e.
+*/
+static void
+de_tail_bound_sup(mag_t bound, acb_calc_func_t f, void * param,
+    const acb_t e, const acb_t delta, const arb_t w, int sign, slong prec)
+{
+    acb_t x, y;
+    arb_t h;
+    mag_t t;
+
+    acb_init(x);
+    acb_init(y);
+    arb_init(h);
+    mag_init(t);
+
+    /* h = [0, w] */
+    arb_mul_2exp_si(h, w, -1);
+    arb_get_mag(t, h);
+    arb_add_error_mag(h, t);
+
+    acb_mul_arb(x, delta, h, prec);
+
+    if (sign == 1)
+        acb_sub(x, e, x, prec);
+    else
+        acb_add(x, e, x, prec);
+
+    f(y, x, param, 0, prec);
+
+    acb_get_mag(bound, y);
+    acb_get_mag(t, delta);
+    mag_mul(bound, bound, t);
+    arb_get_mag(t, w);
+    mag_mul(bound, bound, t);
+
+    acb_clear(x);
+    acb_clear(y);
+    arb_clear(h);
+    mag_clear(t);
+}
+
+/*
+    Given |f(x)| <= C r^(alpha-1) on the cut-off piece, where r is the
+    distance to a finite endpoint (alpha > 0, 0 < r <= L) or a lower
+    bound for |x| (alpha < 0, r >= L), the piece contributes at most
+    C L^alpha / |alpha|. Returns 0 if alpha has the wrong sign.
+*/
+static int
+de_tail_bound_growth(mag_t bound, const mag_t C, const arb_t alpha,
+    const arb_t L, int infinite, slong prec)
+{
+    arb_t t, u;
+    int ok;
+
+    if (infinite ? !arb_is_negative(alpha) : !arb_is_positive(alpha))
+        return 0;
+
+    if (!arb_is_positive(L))
+        return 0;
+
+    arb_init(t);
+    arb_init(u);
+
+    arb_pow(t, L, alpha, prec);
+    arb_abs(u, alpha);
+    arb_div(t, t, u, prec);
+    arf_set_mag(arb_midref(u), C);
+    mag_zero(arb_radref(u));
+    arb_mul(t, t, u, prec);
+
+    arb_get_mag(bound, t);
+    ok = mag_is_finite(bound);
+
+    arb_clear(t);
+    arb_clear(u);
+
+    return ok;
+}
+
+/*
+    Chooses the truncation point T > 0 in the t variable for one end,
+    rounded down to a short dyadic number, and sets s = pi/2 sinh(T).
+    The piece cut off should be of size about 2^(-bits): this needs
+    k alpha s = bits log(2), with k = 2 for tanh-sinh (where the distance
+    to the endpoint is about 2 exp(-2s)) and k = 1 otherwise.
+*/
+static void
+de_truncation(arb_t T, arb_t s, double bits, double k, double alpha, slong prec)
+{
+    arb_t pi;
+
+    arb_init(pi);
+
+    alpha = FLINT_MAX(alpha, 1e-3);
+    arb_set_d(T, bits * 0.69314718055994530942 / (k * alpha)
+                       * 0.63661977236758134308);
+    arb_asinh(T, T, 30);
+    arf_set_round(arb_midref(T), arb_midref(T), 20, ARF_RND_DOWN);
+    mag_zero(arb_radref(T));
+
+    arb_sinh(s, T, prec);
+    arb_const_pi(pi, prec);
+    arb_mul(s, s, pi, prec);
+    arb_mul_2exp_si(s, s, -1);
+
+    arb_clear(pi);
+}
+
+static int
+_acb_is_real_inf(const acb_t z, int sign)
+{
+    return arb_is_zero(acb_imagref(z)) &&
+        mag_is_zero(arb_radref(acb_realref(z))) &&
+        (sign > 0 ? arf_is_pos_inf(arb_midref(acb_realref(z)))
+                  : arf_is_neg_inf(arb_midref(acb_realref(z))));
+}
+
+/*
+    Bounds the piece cut off at the end t = T (right = 1) or t = -T
+    (right = 0) of the t interval. C and alpha describe the behavior of f
+    at the corresponding end of the original path; C = NULL means that no
+    growth bound is available.
+    Returns 0 if no finite bound can be given.
+*/
+static int
+de_tail(mag_t bound, const de_param_struct * p, int right,
+    const arb_t s, const mag_struct * C, const arb_struct * alpha, slong prec)
+{
+    arb_t L, w;
+    acb_t one;
+    int infinite, ok;
+
+    arb_init(L);
+    arb_init(w);
+    acb_init(one);
+
+    infinite = (p->kind == DE_SINH_SINH) ||
+               (right && p->kind != DE_TANH_SINH);
+
+    if (p->kind == DE_TANH_SINH)
+    {
+        /* w = 1 - tanh(s) = 2/(exp(2s)+1), L = |delta| w */
+        arb_mul_2exp_si(w, s, 1);
+        arb_exp(w, w, prec);
+        arb_add_ui(w, w, 1, prec);
+        arb_inv(w, w, prec);
+        arb_mul_2exp_si(w, w, 1);
+        acb_abs(L, p->delta, prec);
+        arb_mul(L, L, w, prec);
+    }
+    else if (p->kind == DE_SINH_SINH)
+    {
+        /* |x| >= sinh(s) */
+        arb_sinh(L, s, prec);
+    }
+    else if (!right)
+    {
+        /* the finite end: |x - e| <= exp(-s) */
+        arb_neg(w, s);
+        arb_exp(L, w, prec);
+        arb_set(w, L);
+    }
+    else
+    {
+        /* |x| >= |Re(x)| >= exp(s) -/+ Re(e) */
+        arb_exp(L, s, prec);
+        if (p->kind == DE_EXP_SINH_RIGHT)
+            arb_add(L, L, acb_realref(p->a), prec);
+        else
+            arb_sub(L, L, acb_realref(p->b), prec);
+    }
+
+    if (C != NULL)
+    {
+        ok = de_tail_bound_growth(bound, C, alpha, L, infinite, prec);
+    }
+    else if (infinite)
+    {
+        ok = 0;
+    }
+    else
+    {
+        if (p->kind == DE_TANH_SINH)
+            de_tail_bound_sup(bound, p->f, p->param, right ? p->b : p->a,
+                p->delta, w, right ? 1 : -1, prec);
+        else if (p->kind == DE_EXP_SINH_RIGHT)
+        {
+            acb_one(one);
+            de_tail_bound_sup(bound, p->f, p->param, p->a, one, w, -1, prec);
+        }
+        else
+        {
+            acb_one(one);
+            de_tail_bound_sup(bound, p->f, p->param, p->b, one, w, 1, prec);
+        }
+
+        ok = mag_is_finite(bound);
+    }
+
+    arb_clear(L);
+    arb_clear(w);
+    acb_clear(one);
+
+    return ok;
+}
+
+int
+acb_calc_integrate_de_growth(acb_t res, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b,
+    const mag_t ca, const arb_t alpha_a,
+    const mag_t cb, const arb_t alpha_b,
+    slong goal, const mag_t tol,
+    const acb_calc_integrate_opt_t options,
+    slong prec)
+{
+    de_param_struct p;
+    acb_calc_integrate_opt_t opt;
+    acb_t mid, delta, ta, tb;
+    arb_t T, s;
+    mag_t tail, t;
+    const mag_struct * C[2];
+    const arb_struct * alpha[2];
+    double target, bits, k, alpha_d;
+    int i, status, negate;
+
+    if (options == NULL)
+    {
+        acb_calc_integrate_opt_init(opt);
+        return acb_calc_integrate_de_growth(res, f, param, a, b,
+            ca, alpha_a, cb, alpha_b, goal, tol, opt, prec);
+    }
+
+    /* orient the path so that infinite ends are -inf at a, +inf at b */
+    negate = _acb_is_real_inf(a, 1) || _acb_is_real_inf(b, -1);
+    if (negate)
+    {
+        const acb_struct * tmp = a; a = b; b = tmp;
+        { const mag_struct * m = ca; ca = cb; cb = m; }
+        { const arb_struct * e = alpha_a; alpha_a = alpha_b; alpha_b = e; }
+    }
+
+    if (acb_is_finite(a) && acb_is_finite(b))
+        p.kind = DE_TANH_SINH;
+    else if (acb_is_finite(a) && _acb_is_real_inf(b, 1))
+        p.kind = DE_EXP_SINH_RIGHT;
+    else if (_acb_is_real_inf(a, -1) && acb_is_finite(b))
+        p.kind = DE_EXP_SINH_LEFT;
+    else if (_acb_is_real_inf(a, -1) && _acb_is_real_inf(b, 1))
+        p.kind = DE_SINH_SINH;
+    else
+    {
+        acb_indeterminate(res);
+        return ARB_CALC_NO_CONVERGENCE;
+    }
+
+    *opt = *options;
+    opt->batch_func = NULL;
+    goal = FLINT_MAX(goal, 0);
+
+    acb_init(mid);
+    acb_init(delta);
+    acb_init(ta);
+    acb_init(tb);
+    arb_init(T);
+    arb_init(s);
+    mag_init(tail);
+    mag_init(t);
+
+    if (p.kind == DE_TANH_SINH)
+    {
+        /* delta = (b-a)/2, mid = (a+b)/2 */
+        acb_sub(delta, b, a, prec);
+        acb_mul_2exp_si(delta, delta, -1);
+        acb_add(mid, a, b, prec);
+        acb_mul_2exp_si(mid, mid, -1);
+    }
+
+    p.f = f;
+    p.param = param;
+    p.a = a;
+    p.b = b;
+    p.mid = mid;
+    p.delta = delta;
+
+    /* the ends t = -T and t = +T of the t interval; for the left
+       exp-sinh map, t = -T corresponds to b and t = +T to -inf */
+    if (p.kind == DE_EXP_SINH_LEFT)
+    {
+        C[0] = cb; alpha[0] = alpha_b;
+        C[1] = ca; alpha[1] = alpha_a;
+    }
+    else
+    {
+        C[0] = ca; alpha[0] = alpha_a;
+        C[1] = cb; alpha[1] = alpha_b;
+    }
+
+    /* a growth bound needs both C and alpha */
+    for (i = 0; i < 2; i++)
+        if (alpha[i] == NULL)
+            C[i] = NULL;
+
+    /*
+        As in acb_calc_integrate, an error of max(tol, 2^(-goal) |I|) is
+        acceptable. The pieces cut off are made smaller than tol/4 or
+        2^(-goal-10) (for an integral of order 1), whichever is larger.
+    */
+    target = goal + 10;
+    if (!mag_is_zero(tol) && mag_is_finite(tol))
+        target = FLINT_MIN(target, 2 - mag_get_d_log2_approx(tol));
+    target = FLINT_MAX(target, 1);
+
+    status = ARB_CALC_SUCCESS;
+
+    /*
+        Truncate each end so that the piece cut off is bounded by about
+        2^(-target), either from a growth bound C r^(alpha-1) (which
+        allows endpoint singularities and infinite ends) or, for a
+        finite end where f is bounded, from the length of the piece
+        times sup |f|.
+    */
+    for (i = 0; i < 2 && status == ARB_CALC_SUCCESS; i++)
+    {
+        bits = target;
+        alpha_d = 1.0;
+
+        if (C[i] != NULL)
+        {
+            alpha_d = fabs(arf_get_d(arb_midref(alpha[i]), ARF_RND_NEAR));
+            if (!mag_is_zero(C[i]))
+                bits += FLINT_MAX(0, mag_get_d_log2_approx(C[i])
+                                   - log(FLINT_MAX(alpha_d, 1e-3)) / log(2));
+        }
+
+        k = (p.kind == DE_TANH_SINH) ? 2.0 : 1.0;
+        if (p.kind == DE_SINH_SINH)
+            bits += 1;
+
+        de_truncation(T, s, bits, k, alpha_d, prec);
+
+        if (i == 0)
+        {
+            acb_set_arb(ta, T);
+            acb_neg(ta, ta);
+        }
+        else
+        {
+            acb_set_arb(tb, T);
+        }
+
+        if (!de_tail(t, &p, i, s, C[i], alpha[i], prec))
+            status = ARB_CALC_NO_CONVERGENCE;
+        else
+            mag_add(tail, tail, t);
+    }
+
+    if (status != ARB_CALC_SUCCESS)
+    {
+        acb_indeterminate(res);
+    }
+    else
+    {
+        status = acb_calc_integrate(res, de_func, &p, ta, tb, goal, tol, opt, prec);
+        acb_add_error_mag(res, tail);
+
+        if (negate)
+            acb_neg(res, res);
+    }
+
+    acb_clear(mid);
+    acb_clear(delta);
+    acb_clear(ta);
+    acb_clear(tb);
+    arb_clear(T);
+    arb_clear(s);
+    mag_clear(tail);
+    mag_clear(t);
+
+    return status;
+}
+
+int
+acb_calc_integrate_de(acb_t res, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b,
+    slong goal, const mag_t tol,
+    const acb_calc_integrate_opt_t options,
+    slong prec)
+{
+    return acb_calc_integrate_de_growth(res, f, param, a, b,
+        NULL, NULL, NULL, NULL, goal, tol, options, prec);
+}
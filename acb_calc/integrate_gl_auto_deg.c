@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "arb_hypgeom.h"
 #include "acb_calc.h"
 
@@ -17,6 +18,17 @@
   and adaptive subdivision. The steps of 2^(n/2) used here give slightly better
   performance than steps of 2^n (we use at most 1.4x more points than
   needed and not 2x more points) but may require more precomputation.
+
+  The cache is shared by all threads. Each degree has its own lock, which
+  is held while copying nodes out of the cache and while computing them,
+  so that threads needing the same degree wait for a single computation
+  instead of duplicating it. The total size is bounded by gl_limit;
+  when a degree does not fit, its nodes are computed on demand.
+
+  Every thread that uses the cache registers gl_cleanup with
+  flint_register_cleanup_function. Since worker threads call flint_cleanup
+  when they finish, the cache is only freed when the last thread that
+  has used it calls flint_cleanup.
 */
 
 #define GL_STEPS 38
@@ -28,52 +40,124 @@ const slong gl_steps[GL_STEPS] = {1, 2, 4, 6, 8, 12, 16, 22, 32, 46, 64,
 
 typedef struct
 {
-    slong gl_prec[GL_STEPS];
-    arb_ptr gl_nodes[GL_STEPS];
-    arb_ptr gl_weights[GL_STEPS];
+    slong prec;
+    slong bytes;
+    arb_ptr nodes;
+    arb_ptr weights;
 }
-gl_cache_struct;
+gl_cache_entry;
 
-TLS_PREFIX gl_cache_struct * gl_cache = NULL;
+static gl_cache_entry gl_cache[GL_STEPS];
+static pthread_mutex_t gl_lock[GL_STEPS];
+static pthread_mutex_t gl_mem_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t gl_once = PTHREAD_ONCE_INIT;
+static slong gl_total_bytes = 0;
+static slong gl_limit = WORD_MAX;
 
-void gl_cleanup()
+static void
+gl_init(void)
 {
     slong i;
 
-    if (gl_cache == NULL)
-        return;
-
     for (i = 0; i < GL_STEPS; i++)
+        pthread_mutex_init(gl_lock + i, NULL);
+}
+
+static slong gl_users = 0;
+static TLS_PREFIX int gl_registered = 0;
+
+static void
+gl_cleanup(void)
+{
+    slong users;
+
+    pthread_mutex_lock(&gl_mem_lock);
+    users = --gl_users;
+    pthread_mutex_unlock(&gl_mem_lock);
+
+    gl_registered = 0;
+
+    if (users == 0)
+        acb_calc_gl_cache_clear();
+}
+
+/* Must be called by each thread before it uses the cache. */
+static void
+gl_use(void)
+{
+    pthread_once(&gl_once, gl_init);
+
+    if (!gl_registered)
     {
-        if (gl_cache->gl_prec[i] != 0)
-        {
-            _arb_vec_clear(gl_cache->gl_nodes[i], (gl_steps[i] + 1) / 2);
-            _arb_vec_clear(gl_cache->gl_weights[i], (gl_steps[i] + 1) / 2);
-        }
+        pthread_mutex_lock(&gl_mem_lock);
+        gl_users++;
+        pthread_mutex_unlock(&gl_mem_lock);
+
+        flint_register_cleanup_function(gl_cleanup);
+        gl_registered = 1;
     }
+}
 
-    flint_free(gl_cache);
-    gl_cache = NULL;
+/* Estimated size of the cached nodes and weights for n = gl_steps[i]. */
+static slong
+gl_bytes(slong i, slong prec)
+{
+    slong len = (gl_steps[i] + 1) / 2;
+
+    return 2 * len * (sizeof(arb_struct) +
+        ((prec + FLINT_BITS - 1) / FLINT_BITS) * sizeof(mp_limb_t));
 }
 
-void gl_init()
+/* Makes sure that degree i is cached to at least prec bits, if the
+   memory limit permits. Must be called with gl_lock[i] held. */
+static int
+gl_ensure(slong i, slong prec)
 {
-    gl_cache = flint_calloc(1, sizeof(gl_cache_struct));
-    flint_register_cleanup_function(gl_cleanup);
+    gl_cache_entry * e = gl_cache + i;
+    slong n, jj, wp, bytes;
+    int ok;
+
+    if (e->prec >= prec)
+        return 1;
+
+    n = gl_steps[i];
+    wp = FLINT_MAX(prec, e->prec * 2 + 30);
+    bytes = gl_bytes(i, wp);
+
+    pthread_mutex_lock(&gl_mem_lock);
+    ok = (gl_total_bytes - e->bytes + bytes <= gl_limit);
+    if (ok)
+        gl_total_bytes += bytes - e->bytes;
+    pthread_mutex_unlock(&gl_mem_lock);
+
+    if (!ok)
+        return 0;
+
+    if (e->prec == 0)
+    {
+        e->nodes = _arb_vec_init((n + 1) / 2);
+        e->weights = _arb_vec_init((n + 1) / 2);
+    }
+
+    for (jj = 0; 2 * jj < n; jj++)
+        arb_hypgeom_legendre_p_ui_root(e->nodes + jj, e->weights + jj, n, jj, wp);
+
+    e->prec = wp;
+    e->bytes = bytes;
+
+    return 1;
 }
 
 /* Compute GL node and weight of index k for n = gl_steps[i]. Cached. */
 void
 acb_calc_gl_node(arb_t x, arb_t w, slong i, slong k, slong prec)
 {
-    slong n, kk, jj, wp;
+    slong n, kk;
+    int cached;
 
     if (i < 0 || i >= GL_STEPS || prec < 2)
         flint_abort();
 
-    if (gl_cache == NULL)
-        gl_init();
-
     n = gl_steps[i];
 
     if (k < 0 || k >= n)
@@ -84,31 +168,154 @@ acb_calc_gl_node(arb_t x, arb_t w, slong i, slong k, slong prec)
     else
         kk = n - 1 - k;
 
-    if (gl_cache->gl_prec[i] < prec)
+    gl_use();
+    pthread_mutex_lock(gl_lock + i);
+
+    cached = gl_ensure(i, prec);
+
+    if (cached)
     {
-        if (gl_cache->gl_prec[i] == 0)
-        {
-            gl_cache->gl_nodes[i] = _arb_vec_init((n + 1) / 2);
-            gl_cache->gl_weights[i] = _arb_vec_init((n + 1) / 2);
-        }
+        arb_set_round(x, gl_cache[i].nodes + kk, prec);
+        arb_set_round(w, gl_cache[i].weights + kk, prec);
+    }
 
-        wp = FLINT_MAX(prec, gl_cache->gl_prec[i] * 2 + 30);
+    pthread_mutex_unlock(gl_lock + i);
 
-        for (jj = 0; 2 * jj < n; jj++)
-        {
-            arb_hypgeom_legendre_p_ui_root(gl_cache->gl_nodes[i] + jj,
-                gl_cache->gl_weights[i] + jj, n, jj, wp);
-        }
+    if (!cached)
+        arb_hypgeom_legendre_p_ui_root(x, w, n, kk, prec);
 
-        gl_cache->gl_prec[i] = wp;
+    if (2 * k >= n)
+        arb_neg(x, x);
+}
+
+typedef struct
+{
+    slong start;
+    slong step;
+    slong deg_limit;
+    slong prec;
+}
+gl_prewarm_arg_t;
+
+static void *
+gl_prewarm_worker(void * arg_ptr)
+{
+    gl_prewarm_arg_t arg = *((gl_prewarm_arg_t *) arg_ptr);
+    slong i;
+
+    gl_use();
+
+    for (i = arg.start; i < GL_STEPS && gl_steps[i] <= arg.deg_limit; i += arg.step)
+    {
+        pthread_mutex_lock(gl_lock + i);
+        gl_ensure(i, arg.prec);
+        pthread_mutex_unlock(gl_lock + i);
     }
 
-    if (2 * k < n)
-        arb_set_round(x, gl_cache->gl_nodes[i] + kk, prec);
-    else
-        arb_neg_round(x, gl_cache->gl_nodes[i] + kk, prec);
+    flint_cleanup();
+
+    return NULL;
+}
+
+void
+acb_calc_gl_cache_prewarm(slong deg_limit, slong prec)
+{
+    pthread_t * threads;
+    gl_prewarm_arg_t * args;
+    slong i, num, num_threads;
 
-    arb_set_round(w, gl_cache->gl_weights[i] + kk, prec);
+    if (prec < 2)
+        return;
+
+    gl_use();
+
+    for (num = 0; num < GL_STEPS && gl_steps[num] <= deg_limit; num++) ;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num);
+
+    if (num_threads <= 0)
+        return;
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(gl_prewarm_arg_t) * num_threads);
+
+    /* the cost grows with the degree, so the degrees are distributed
+       cyclically */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].start = i;
+        args[i].step = num_threads;
+        args[i].deg_limit = deg_limit;
+        args[i].prec = prec;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, gl_prewarm_worker, &args[i]);
+
+    /* the current thread does its own share without calling flint_cleanup */
+    for (i = 0; i < num && gl_steps[i] <= deg_limit; i += num_threads)
+    {
+        pthread_mutex_lock(gl_lock + i);
+        gl_ensure(i, prec);
+        pthread_mutex_unlock(gl_lock + i);
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void
+acb_calc_gl_cache_set_limit(slong bytes)
+{
+    pthread_mutex_lock(&gl_mem_lock);
+    gl_limit = FLINT_MAX(bytes, 0);
+    pthread_mutex_unlock(&gl_mem_lock);
+}
+
+slong
+acb_calc_gl_cache_allocated_bytes(void)
+{
+    slong bytes;
+
+    pthread_mutex_lock(&gl_mem_lock);
+    bytes = gl_total_bytes;
+    pthread_mutex_unlock(&gl_mem_lock);
+
+    return bytes;
+}
+
+void
+acb_calc_gl_cache_clear(void)
+{
+    slong i, n;
+
+    pthread_once(&gl_once, gl_init);
+
+    for (i = 0; i < GL_STEPS; i++)
+    {
+        pthread_mutex_lock(gl_lock + i);
+
+        if (gl_cache[i].prec != 0)
+        {
+            n = gl_steps[i];
+            _arb_vec_clear(gl_cache[i].nodes, (n + 1) / 2);
+            _arb_vec_clear(gl_cache[i].weights, (n + 1) / 2);
+
+            pthread_mutex_lock(&gl_mem_lock);
+            gl_total_bytes -= gl_cache[i].bytes;
+            pthread_mutex_unlock(&gl_mem_lock);
+
+            gl_cache[i].prec = 0;
+            gl_cache[i].bytes = 0;
+            gl_cache[i].nodes = NULL;
+            gl_cache[i].weights = NULL;
+        }
+
+        pthread_mutex_unlock(gl_lock + i);
+    }
 }
 
 int
@@ -116,6 +323,16 @@ acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
     acb_calc_func_t f, void * param,
     const acb_t a, const acb_t b, const mag_t tol,
     slong deg_limit, int verbose, slong prec)
+{
+    return acb_calc_integrate_gl_auto_deg_batch(res, eval_count, f, NULL,
+        param, a, b, tol, deg_limit, verbose, prec);
+}
+
+int
+acb_calc_integrate_gl_auto_deg_batch(acb_t res, slong * eval_count,
+    acb_calc_func_t f, acb_calc_batch_func_t fbatch, void * param,
+    const acb_t a, const acb_t b, const mag_t tol,
+    slong deg_limit, int verbose, slong prec)
 {
     acb_t mid, delta, wide;
     mag_t tmpm;
@@ -261,13 +478,41 @@ acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
 
         acb_zero(s);
 
-        for (k = 0; k < best_n; k++)
+        if (fbatch != NULL)
+        {
+            acb_ptr xs, vs;
+            arb_ptr ws;
+
+            xs = _acb_vec_init(best_n);
+            vs = _acb_vec_init(best_n);
+            ws = _arb_vec_init(best_n);
+
+            for (k = 0; k < best_n; k++)
+            {
+                acb_calc_gl_node(x, ws + k, i, k, prec);
+                acb_mul_arb(xs + k, delta, x, prec);
+                acb_add(xs + k, xs + k, mid, prec);
+            }
+
+            fbatch(vs, xs, best_n, param, 0, prec);
+
+            for (k = 0; k < best_n; k++)
+                acb_addmul_arb(s, vs + k, ws + k, prec);
+
+            _acb_vec_clear(xs, best_n);
+            _acb_vec_clear(vs, best_n);
+            _arb_vec_clear(ws, best_n);
+        }
+        else
         {
-            acb_calc_gl_node(x, w, i, k, prec);
-            acb_mul_arb(wide, delta, x, prec);
-            acb_add(wide, wide, mid, prec);
-            f(v, wide, param, 0, prec);
-            acb_addmul_arb(s, v, w, prec);
+            for (k = 0; k < best_n; k++)
+            {
+                acb_calc_gl_node(x, w, i, k, prec);
+                acb_mul_arb(wide, delta, x, prec);
+                acb_add(wide, wide, mid, prec);
+                f(v, wide, param, 0, prec);
+                acb_addmul_arb(s, v, w, prec);
+            }
         }
 
         eval_count[0] += best_n;
@@ -0,0 +1,135 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_calc.h"
+
+int
+f_exp(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_exp(res, z, prec);
+
+    return 0;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("gl_cache....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200 * arb_test_multiplier(); iter++)
+    {
+        acb_t a, b, res, ans;
+        mag_t tol;
+        slong prec, limit, deg_limit;
+        acb_calc_integrate_opt_t opt;
+
+        acb_init(a);
+        acb_init(b);
+        acb_init(res);
+        acb_init(ans);
+        mag_init(tol);
+        acb_calc_integrate_opt_init(opt);
+
+        prec = 2 + n_randint(state, 300);
+        deg_limit = n_randint(state, 200);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                limit = 0;
+                break;
+            case 1:
+                limit = n_randint(state, 100000);
+                break;
+            default:
+                limit = WORD_MAX;
+        }
+
+        /* lowering the limit does not evict nodes that are already cached */
+        if (limit != WORD_MAX)
+            acb_calc_gl_cache_clear();
+
+        acb_calc_gl_cache_set_limit(limit);
+
+        if (n_randint(state, 2))
+            acb_calc_gl_cache_prewarm(deg_limit, 2 + n_randint(state, 300));
+
+        if (acb_calc_gl_cache_allocated_bytes() > limit)
+        {
+            flint_printf("FAIL: limit\n\n");
+            flint_printf("limit = %wd, bytes = %wd\n\n",
+                limit, acb_calc_gl_cache_allocated_bytes());
+            flint_abort();
+        }
+
+        /* exp(z) on [0, b] */
+        acb_randtest(b, state, 1 + n_randint(state, 200), 2);
+        mag_set_ui_2exp_si(tol, 1, -prec);
+
+        acb_calc_integrate(res, f_exp, NULL, a, b, prec, tol, opt, prec);
+
+        acb_exp(ans, b, prec);
+        acb_sub_ui(ans, ans, 1, prec);
+
+        if (!acb_overlaps(res, ans))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("b = "); acb_printd(b, 30); flint_printf("\n\n");
+            flint_printf("res = "); acb_printd(res, 30); flint_printf("\n\n");
+            flint_printf("ans = "); acb_printd(ans, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        if (acb_calc_gl_cache_allocated_bytes() > limit)
+        {
+            flint_printf("FAIL: limit (2)\n\n");
+            flint_printf("limit = %wd, bytes = %wd\n\n",
+                limit, acb_calc_gl_cache_allocated_bytes());
+            flint_abort();
+        }
+
+        if (n_randint(state, 4) == 0)
+        {
+            acb_calc_gl_cache_clear();
+
+            if (acb_calc_gl_cache_allocated_bytes() != 0)
+            {
+                flint_printf("FAIL: clear\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(res);
+        acb_clear(ans);
+        mag_clear(tol);
+    }
+
+    acb_calc_gl_cache_set_limit(WORD_MAX);
+    acb_calc_gl_cache_clear();
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
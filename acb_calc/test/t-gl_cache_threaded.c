@@ -0,0 +1,161 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "acb_calc.h"
+
+int
+f_exp(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_exp(res, z, prec);
+
+    return 0;
+}
+
+typedef struct
+{
+    acb_ptr res;
+    acb_srcptr b;
+    slong deg_limit;
+    slong prec;
+}
+work_t;
+
+void
+integrate_exp(acb_t res, const acb_t b, slong deg_limit, slong prec)
+{
+    acb_t a;
+    mag_t tol;
+    slong count;
+
+    acb_init(a);
+    mag_init(tol);
+
+    mag_set_ui_2exp_si(tol, 1, -prec);
+    acb_calc_integrate_gl_auto_deg(res, &count, f_exp, NULL, a, b,
+        tol, deg_limit, 0, prec);
+
+    acb_clear(a);
+    mag_clear(tol);
+}
+
+void *
+worker(void * arg_ptr)
+{
+    work_t arg = *((work_t *) arg_ptr);
+
+    integrate_exp(arg.res, arg.b, arg.deg_limit, arg.prec);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("gl_cache_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        pthread_t threads[8];
+        work_t args[8];
+        acb_ptr res;
+        acb_t b, ans, t;
+        slong i, num_threads, prec, deg_limit;
+        int same_prec;
+
+        num_threads = 2 + n_randint(state, 7);
+        res = _acb_vec_init(num_threads);
+        acb_init(b);
+        acb_init(ans);
+        acb_init(t);
+
+        same_prec = n_randint(state, 2);
+        prec = 2 + n_randint(state, 300);
+        deg_limit = 1 + n_randint(state, 300);
+        acb_randtest(b, state, 1 + n_randint(state, 200), 2);
+
+        /* all threads need the nodes for the first time at once */
+        acb_calc_gl_cache_clear();
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].res = res + i;
+            args[i].b = b;
+            args[i].deg_limit = deg_limit;
+            args[i].prec = same_prec ? prec : 2 + n_randint(state, 300);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, worker, &args[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            acb_exp(ans, b, args[i].prec);
+            acb_sub_ui(ans, ans, 1, args[i].prec);
+
+            if (!acb_overlaps(res + i, ans) ||
+                (same_prec && !acb_equal(res + i, res)))
+            {
+                flint_printf("FAIL (iter = %wd)\n\n", iter);
+                flint_printf("i = %wd, same_prec = %d, prec = %wd\n\n",
+                    i, same_prec, args[i].prec);
+                flint_printf("b = "); acb_printd(b, 30); flint_printf("\n\n");
+                flint_printf("res[i] = "); acb_printd(res + i, 30); flint_printf("\n\n");
+                flint_printf("res[0] = "); acb_printd(res, 30); flint_printf("\n\n");
+                flint_printf("ans = "); acb_printd(ans, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* the nodes cached by the threads agree with a serial computation */
+        if (same_prec)
+        {
+            acb_calc_gl_cache_clear();
+            integrate_exp(t, b, deg_limit, prec);
+
+            for (i = 0; i < num_threads; i++)
+            {
+                if (!acb_equal(res + i, t))
+                {
+                    flint_printf("FAIL (serial, iter = %wd)\n\n", iter);
+                    flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                    flint_printf("res[i] = "); acb_printd(res + i, 30); flint_printf("\n\n");
+                    flint_abort();
+                }
+            }
+        }
+
+        _acb_vec_clear(res, num_threads);
+        acb_clear(b);
+        acb_clear(ans);
+        acb_clear(t);
+    }
+
+    acb_calc_gl_cache_clear();
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
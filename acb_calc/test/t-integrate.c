@@ -374,6 +374,12 @@ int main()
 
         opt->use_heap = n_randint(state, 2);
 
+        if (n_randint(state, 4) == 0)
+        {
+            opt->num_threads = 1 + n_randint(state, 4);
+            opt->deterministic = n_randint(state, 2);
+        }
+
         integral = n_randint(state, 9);
 
         if (integral == 0)
@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_calc.h"
+
+int
+f_exp(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_exp(res, z, prec);
+
+    return 0;
+}
+
+/* param is NULL or points to a counter of the number of batched calls */
+int
+f_exp_batch(acb_ptr res, acb_srcptr z, slong len, void * param, slong order, slong prec)
+{
+    slong i;
+
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    for (i = 0; i < len; i++)
+        acb_exp(res + i, z + i, prec);
+
+    if (param != NULL)
+        (*((slong *) param))++;
+
+    return 0;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("integrate_batch....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        acb_t a, b, res, ans;
+        slong goal, prec, count, eval;
+        mag_t tol;
+        acb_calc_integrate_opt_t opt;
+        int status;
+
+        acb_init(a);
+        acb_init(b);
+        acb_init(res);
+        acb_init(ans);
+        mag_init(tol);
+        acb_calc_integrate_opt_init(opt);
+
+        goal = 2 + n_randint(state, 200);
+        prec = 2 + n_randint(state, 200);
+        mag_set_ui_2exp_si(tol, 1, -goal);
+
+        acb_randtest(a, state, 1 + n_randint(state, 200), 2);
+        acb_randtest(b, state, 1 + n_randint(state, 200), 2);
+
+        acb_exp(ans, b, prec);
+        acb_exp(res, a, prec);
+        acb_sub(ans, ans, res, prec);
+
+        opt->batch_func = f_exp_batch;
+        opt->use_heap = n_randint(state, 2);
+
+        if (n_randint(state, 2))
+            opt->num_threads = 1 + n_randint(state, 3);
+
+        if (opt->num_threads > 1)
+            opt->deterministic = 1;
+
+        acb_calc_integrate(res, f_exp, NULL, a, b, goal, tol, opt, prec);
+
+        if (!acb_overlaps(res, ans))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("a = "); acb_printd(a, 30); flint_printf("\n\n");
+            flint_printf("b = "); acb_printd(b, 30); flint_printf("\n\n");
+            flint_printf("res = "); acb_printd(res, 30); flint_printf("\n\n");
+            flint_printf("ans = "); acb_printd(ans, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* a successful Gauss-Legendre step makes exactly one batched call */
+        count = 0;
+        status = acb_calc_integrate_gl_auto_deg_batch(res, &eval, f_exp,
+            f_exp_batch, &count, a, b, tol, 100, 0, prec);
+
+        if ((status == ARB_CALC_SUCCESS && (count != 1 || !acb_overlaps(res, ans)))
+            || (status != ARB_CALC_SUCCESS && count != 0))
+        {
+            flint_printf("FAIL: gl_auto_deg_batch\n\n");
+            flint_printf("status = %d, count = %wd\n\n", status, count);
+            flint_printf("res = "); acb_printd(res, 30); flint_printf("\n\n");
+            flint_printf("ans = "); acb_printd(ans, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(res);
+        acb_clear(ans);
+        mag_clear(tol);
+    }
+
+    acb_calc_gl_cache_clear();
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,263 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_calc.h"
+
+int
+f_exp(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_exp(res, z, prec);
+
+    return 0;
+}
+
+/* f(z) = sqrt(1-z^2) */
+int
+f_circle(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_one(res);
+    acb_submul(res, z, z, prec);
+    acb_sqrt_analytic(res, res, order != 0, prec);
+
+    return 0;
+}
+
+/* f(z) = 1/sqrt(z) */
+int
+f_rsqrt(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_rsqrt_analytic(res, z, order != 0, prec);
+
+    return 0;
+}
+
+int
+f_log(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_log_analytic(res, z, order != 0, prec);
+
+    return 0;
+}
+
+/* f(z) = 1/(1+z^2) */
+int
+f_lorentz(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_one(res);
+    acb_addmul(res, z, z, prec);
+    acb_inv(res, res, prec);
+
+    return 0;
+}
+
+/* f(z) = exp(-z) */
+int
+f_expneg(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_neg(res, z);
+    acb_exp(res, res, prec);
+
+    return 0;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("integrate_de....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 500 * arb_test_multiplier(); iter++)
+    {
+        acb_t a, b, res, ans;
+        slong goal, prec;
+        mag_t tol, c;
+        arb_t alpha;
+        acb_calc_integrate_opt_t opt;
+        int status, which;
+
+        acb_init(a);
+        acb_init(b);
+        acb_init(res);
+        acb_init(ans);
+        mag_init(tol);
+        mag_init(c);
+        arb_init(alpha);
+        acb_calc_integrate_opt_init(opt);
+
+        which = n_randint(state, 8);
+        goal = 2 + n_randint(state, 200);
+        prec = 2 + n_randint(state, 200);
+        mag_set_ui_2exp_si(tol, 1, -goal);
+        opt->num_threads = 1 + n_randint(state, 3);
+
+        if (which == 0)
+        {
+            acb_randtest(a, state, 1 + n_randint(state, 200), 2);
+            acb_randtest(b, state, 1 + n_randint(state, 200), 2);
+
+            acb_exp(ans, b, prec);
+            acb_exp(res, a, prec);
+            acb_sub(ans, ans, res, prec);
+
+            status = acb_calc_integrate_de(res, f_exp, NULL, a, b,
+                goal, tol, opt, prec);
+        }
+        else if (which == 1)
+        {
+            /* int_{-1}^{1} sqrt(1-x^2) dx = pi/2 */
+            acb_set_si(a, -1);
+            acb_one(b);
+
+            acb_const_pi(ans, prec);
+            acb_mul_2exp_si(ans, ans, -1);
+
+            goal = prec = 10 + n_randint(state, 200);
+            mag_set_ui_2exp_si(tol, 1, -goal);
+
+            status = acb_calc_integrate_de(res, f_circle, NULL, a, b,
+                goal, tol, opt, prec);
+        }
+        else
+        {
+            goal = prec = 10 + n_randint(state, 100);
+            mag_set_ui_2exp_si(tol, 1, -goal);
+
+            /* growth bounds C |x-e|^(alpha-1) */
+            mag_one(c);
+
+            if (which == 2)
+            {
+                /* int_0^1 1/sqrt(x) dx = 2 */
+                acb_zero(a);
+                acb_one(b);
+                acb_set_ui(ans, 2);
+                arb_set_d(alpha, 0.5);
+
+                status = acb_calc_integrate_de_growth(res, f_rsqrt, NULL,
+                    a, b, c, alpha, NULL, NULL, goal, tol, opt, prec);
+            }
+            else if (which == 3)
+            {
+                /* int_0^1 log(x) dx = -1, with |log(x)| <= x^(-1/2) */
+                acb_zero(a);
+                acb_one(b);
+                acb_set_si(ans, -1);
+                arb_set_d(alpha, 0.5);
+
+                /* a NULL exponent at b means no growth information */
+                status = acb_calc_integrate_de_growth(res, f_log, NULL,
+                    a, b, c, alpha, c, NULL, goal, tol, opt, prec);
+            }
+            else if (which == 4)
+            {
+                /* int_0^inf 1/(1+x^2) dx = pi/2 */
+                acb_zero(a);
+                acb_zero(b);
+                arb_pos_inf(acb_realref(b));
+                acb_const_pi(ans, prec);
+                acb_mul_2exp_si(ans, ans, -1);
+                arb_set_si(alpha, -1);
+
+                status = acb_calc_integrate_de_growth(res, f_lorentz, NULL,
+                    a, b, NULL, NULL, c, alpha, goal, tol, opt, prec);
+            }
+            else if (which == 5)
+            {
+                /* int_inf^0 1/(1+x^2) dx = -pi/2 */
+                acb_zero(a);
+                arb_pos_inf(acb_realref(a));
+                acb_zero(b);
+                acb_const_pi(ans, prec);
+                acb_mul_2exp_si(ans, ans, -1);
+                acb_neg(ans, ans);
+                arb_set_si(alpha, -1);
+
+                status = acb_calc_integrate_de_growth(res, f_lorentz, NULL,
+                    a, b, c, alpha, NULL, NULL, goal, tol, opt, prec);
+            }
+            else if (which == 6)
+            {
+                /* int_-inf^inf 1/(1+x^2) dx = pi */
+                acb_zero(a);
+                arb_neg_inf(acb_realref(a));
+                acb_zero(b);
+                arb_pos_inf(acb_realref(b));
+                acb_const_pi(ans, prec);
+                arb_set_si(alpha, -1);
+
+                status = acb_calc_integrate_de_growth(res, f_lorentz, NULL,
+                    a, b, c, alpha, c, alpha, goal, tol, opt, prec);
+            }
+            else
+            {
+                /* int_0^inf exp(-x) dx = 1, with exp(-x) <= x^(-2) */
+                acb_zero(a);
+                acb_zero(b);
+                arb_pos_inf(acb_realref(b));
+                acb_one(ans);
+                arb_set_si(alpha, -1);
+
+                status = acb_calc_integrate_de_growth(res, f_expneg, NULL,
+                    a, b, NULL, NULL, c, alpha, goal, tol, opt, prec);
+            }
+        }
+
+        if (!acb_overlaps(res, ans) ||
+            (which != 0 && status == ARB_CALC_SUCCESS &&
+                acb_rel_accuracy_bits(res) < goal / 2))
+        {
+            flint_printf("FAIL! (iter = %wd)\n", iter);
+            flint_printf("which = %d, status = %d, prec = %wd, goal = %wd\n\n",
+                which, status, prec, goal);
+            flint_printf("a = "); acb_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); acb_printd(b, 15); flint_printf("\n\n");
+            flint_printf("res = "); acb_printd(res, 15); flint_printf("\n\n");
+            flint_printf("ans = "); acb_printd(ans, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(res);
+        acb_clear(ans);
+        mag_clear(tol);
+        mag_clear(c);
+        arb_clear(alpha);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
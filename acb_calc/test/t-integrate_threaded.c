@@ -0,0 +1,121 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_calc.h"
+
+/* f(z) = floor(z) * sin(z), which forces subdivision at the integers */
+int
+f_floor_sin(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    acb_t t;
+
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    acb_init(t);
+    acb_real_floor(t, z, order != 0, prec);
+    acb_sin(res, z, prec);
+    acb_mul(res, res, t, prec);
+    acb_clear(t);
+
+    return 0;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("integrate_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        acb_t a, b, res1, res2, res3;
+        slong goal, prec;
+        mag_t tol;
+        acb_calc_integrate_opt_t opt;
+
+        acb_init(a);
+        acb_init(b);
+        acb_init(res1);
+        acb_init(res2);
+        acb_init(res3);
+        mag_init(tol);
+        acb_calc_integrate_opt_init(opt);
+
+        goal = 2 + n_randint(state, 100);
+        prec = 2 + n_randint(state, 100);
+        mag_set_ui_2exp_si(tol, 1, -goal);
+
+        acb_set_si(a, n_randint(state, 5));
+        acb_set_si(b, 1 + n_randint(state, 40));
+        acb_mul_2exp_si(b, b, -2);
+
+        opt->use_heap = n_randint(state, 2);
+
+        /* serial reference */
+        acb_calc_integrate(res1, f_floor_sin, NULL, a, b, goal, tol, opt, prec);
+
+        /* deterministic mode gives identical results on repeated runs */
+        opt->num_threads = 2 + n_randint(state, 3);
+        opt->deterministic = 1;
+        acb_calc_integrate(res2, f_floor_sin, NULL, a, b, goal, tol, opt, prec);
+        acb_calc_integrate(res3, f_floor_sin, NULL, a, b, goal, tol, opt, prec);
+
+        if (!acb_overlaps(res1, res2) || !acb_equal(res2, res3))
+        {
+            flint_printf("FAIL: deterministic\n\n");
+            flint_printf("b = "); acb_printd(b, 30); flint_printf("\n\n");
+            flint_printf("res1 = "); acb_printd(res1, 30); flint_printf("\n\n");
+            flint_printf("res2 = "); acb_printd(res2, 30); flint_printf("\n\n");
+            flint_printf("res3 = "); acb_printd(res3, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* a negative value opts in to flint_get_num_threads() threads */
+        if (n_randint(state, 2))
+        {
+            flint_set_num_threads(2 + n_randint(state, 3));
+            opt->num_threads = -1;
+        }
+
+        opt->deterministic = 0;
+        acb_calc_integrate(res3, f_floor_sin, NULL, a, b, goal, tol, opt, prec);
+        flint_set_num_threads(1);
+
+        if (!acb_overlaps(res1, res3))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("b = "); acb_printd(b, 30); flint_printf("\n\n");
+            flint_printf("res1 = "); acb_printd(res1, 30); flint_printf("\n\n");
+            flint_printf("res3 = "); acb_printd(res3, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(res1);
+        acb_clear(res2);
+        acb_clear(res3);
+        mag_clear(tol);
+    }
+
+    acb_calc_gl_cache_clear();
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -22,6 +22,7 @@
 
 #include "acb.h"
 #include "acb_poly.h"
+#include "arb_calc.h"
 #include "dirichlet.h"
 
 #ifdef __cplusplus
@@ -32,15 +33,21 @@ void acb_dirichlet_powsum_term(acb_ptr res, arb_t log_prev, ulong * prev,
     const acb_t s, ulong k, int integer, int critical_line, slong len, slong prec);
 
 void acb_dirichlet_powsum_sieved(acb_ptr z, const acb_t s, ulong n, slong len, slong prec);
+void acb_dirichlet_powsum_sieved_threaded(acb_ptr z, const acb_t s, ulong n, slong len, slong prec);
 void acb_dirichlet_powsum_smooth(acb_ptr z, const acb_t s, ulong n, slong len, slong prec);
+void acb_dirichlet_powsum_grid(acb_ptr res, const arb_t sigma, const arb_t t0,
+    const arb_t h, ulong n, slong num, slong prec);
 
 void acb_dirichlet_zeta_bound(mag_t res, const acb_t s);
 void acb_dirichlet_zeta_deriv_bound(mag_t der1, mag_t der2, const acb_t s);
 void acb_dirichlet_zeta_rs_f_coeffs(acb_ptr c, const arb_t p, slong N, slong prec);
 void acb_dirichlet_zeta_rs_d_coeffs(arb_ptr d, const arb_t sigma, slong k, slong prec);
 void acb_dirichlet_zeta_rs_bound(mag_t err, const acb_t s, slong K);
+slong _acb_dirichlet_zeta_rs_r_asymp(acb_t res, fmpz_t N, const acb_t s, slong K, slong prec);
 void acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec);
 void acb_dirichlet_zeta_rs(acb_t res, const acb_t s, slong K, slong prec);
+void acb_dirichlet_zeta_rs_grid(acb_ptr res, const arb_t sigma, const arb_t t0,
+    const arb_t h, slong num, slong K, slong prec);
 void acb_dirichlet_zeta(acb_t res, const acb_t s, slong prec);
 
 void acb_dirichlet_zeta_jet_rs(acb_ptr res, const acb_t s, slong len, slong prec);
@@ -71,6 +78,13 @@ void acb_dirichlet_hurwitz_precomp_bound(mag_t res, const acb_t s, slong A, slon
 void acb_dirichlet_hurwitz_precomp_eval(acb_t res, const acb_dirichlet_hurwitz_precomp_t pre, ulong p, ulong q, slong prec);
 void acb_dirichlet_hurwitz_precomp_choose_param(ulong * A, ulong * K, ulong * N, const acb_t s, double num_eval, slong prec);
 
+ARB_DLL extern slong acb_dirichlet_hurwitz_precomp_cache_max_bytes;
+
+void acb_dirichlet_hurwitz_precomp_init_cached(acb_dirichlet_hurwitz_precomp_t pre, const acb_t s, int deflate, slong A, slong K, slong N, slong prec);
+void acb_dirichlet_hurwitz_precomp_init_num_cached(acb_dirichlet_hurwitz_precomp_t pre, const acb_t s, int deflate, double num_eval, slong prec);
+void acb_dirichlet_hurwitz_precomp_cache_clear(void);
+slong acb_dirichlet_hurwitz_precomp_cache_bytes(void);
+
 void _acb_dirichlet_euler_product_real_ui(arb_t res, ulong s,
     const signed char * chi, int mod, int reciprocal, slong prec);
 
@@ -121,9 +135,11 @@ void acb_dirichlet_gauss_sum_factor(acb_t res, const dirichlet_group_t G, const
 void acb_dirichlet_gauss_sum_order2(acb_t res, const dirichlet_group_t G, const dirichlet_char_t chi, slong prec);
 void acb_dirichlet_gauss_sum_theta(acb_t res, const dirichlet_group_t G, const dirichlet_char_t chi, slong prec);
 void acb_dirichlet_gauss_sum(acb_t res, const dirichlet_group_t G, const dirichlet_char_t chi, slong prec);
+void acb_dirichlet_gauss_sum_vec(acb_ptr res, const dirichlet_group_t G, slong prec);
 
 void acb_dirichlet_root_number_theta(acb_t res, const dirichlet_group_t G, const dirichlet_char_t chi, slong prec);
 void acb_dirichlet_root_number(acb_t res, const dirichlet_group_t G, const dirichlet_char_t chi, slong prec);
+void acb_dirichlet_root_number_vec(acb_ptr res, const dirichlet_group_t G, slong prec);
 
 void acb_dirichlet_si_poly_evaluate(acb_t res, slong * v, slong len, const acb_t z, slong prec);
 
@@ -133,6 +149,7 @@ void acb_dirichlet_jacobi_sum_factor(acb_t res,  const dirichlet_group_t G, cons
 void acb_dirichlet_jacobi_sum_gauss(acb_t res, const dirichlet_group_t G, const dirichlet_char_t chi1, const dirichlet_char_t chi2, slong prec);
 void acb_dirichlet_jacobi_sum(acb_t res, const dirichlet_group_t G, const dirichlet_char_t chi1, const dirichlet_char_t chi2, slong prec);
 void acb_dirichlet_jacobi_sum_ui(acb_t res, const dirichlet_group_t G, ulong a, ulong b, slong prec);
+void acb_dirichlet_jacobi_sum_vec(acb_ptr res, const dirichlet_group_t G, const dirichlet_char_t chi1, slong prec);
 
 void acb_dirichlet_l_euler_product(acb_t res, const acb_t s, const dirichlet_group_t G, const dirichlet_char_t chi, slong prec);
 
@@ -142,6 +159,9 @@ void acb_dirichlet_l_hurwitz(acb_t res, const acb_t s, const acb_dirichlet_hurwi
 void acb_dirichlet_l(acb_t res, const acb_t s, const dirichlet_group_t G, const dirichlet_char_t chi, slong prec);
 
 void acb_dirichlet_l_vec_hurwitz(acb_ptr res, const acb_t s, const acb_dirichlet_hurwitz_precomp_t precomp, const dirichlet_group_t G, slong prec);
+void acb_dirichlet_l_vec_hurwitz_multi(acb_ptr res, acb_srcptr s,
+    const acb_dirichlet_hurwitz_precomp_struct * precomp, slong num,
+    const dirichlet_group_t G, slong prec);
 
 void acb_dirichlet_l_jet(acb_ptr res, const acb_t s, const dirichlet_group_t G, const dirichlet_char_t chi, int deflate, slong len, slong prec);
 
@@ -174,6 +194,17 @@ void _acb_dirichlet_isolate_rosser_hardy_z_zero(arf_t a, arf_t b, const fmpz_t n
 void _acb_dirichlet_isolate_turing_hardy_z_zero(arf_t a, arf_t b, const fmpz_t n);
 void acb_dirichlet_isolate_hardy_z_zero(arf_t a, arf_t b, const fmpz_t n);
 void _acb_dirichlet_refine_hardy_z_zero(arb_t res, const arf_t a, const arf_t b, slong prec);
+
+typedef struct
+{
+    slong prec; /* largest working precision used */
+    slong evals; /* number of function evaluations */
+    slong accuracy; /* relative accuracy of the output in bits */
+}
+acb_dirichlet_hardy_z_zero_stats_struct;
+
+void acb_dirichlet_isolate_hardy_z_zeros(arf_interval_ptr res, const fmpz_t n, slong len);
+void _acb_dirichlet_refine_hardy_z_zeros(arb_ptr res, acb_dirichlet_hardy_z_zero_stats_struct * stats, arf_interval_srcptr p, slong len, slong prec);
 void acb_dirichlet_hardy_z_zeros(arb_ptr res, const fmpz_t n, slong len, slong prec);
 void acb_dirichlet_zeta_zeros(acb_ptr res, const fmpz_t n, slong len, slong prec);
 void _acb_dirichlet_exact_zeta_nzeros(fmpz_t res, const arf_t t);
@@ -287,6 +318,9 @@ void acb_dirichlet_platt_lemma_B2(arb_t out, slong K, const arb_t h,
 
 void acb_dirichlet_platt_multieval(arb_ptr out, const fmpz_t T, slong A,
     slong B, const arb_t h, slong J, slong K, slong sigma, slong prec);
+void acb_dirichlet_platt_multieval_threaded(arb_ptr out, const fmpz_t T,
+    slong A, slong B, const arb_t h, slong J, slong K, slong sigma,
+    slong prec);
 
 slong _acb_dirichlet_platt_local_hardy_z_zeros(
     arb_ptr res, const fmpz_t n, slong len,
@@ -294,6 +328,35 @@ slong _acb_dirichlet_platt_local_hardy_z_zeros(
     const arb_t h, slong J, slong K, slong sigma_grid,
     slong Ns_max, const arb_t H, slong sigma_interp, slong prec);
 
+typedef struct
+{
+    fmpz n; /* index of the next zero to be returned */
+    slong A;
+    slong B;
+    arb_struct h;
+    slong J;
+    slong K;
+    slong sigma_grid;
+    slong Ns_max;
+    arb_struct H;
+    slong sigma_interp;
+    slong prec;
+    void * ctx; /* current grid window */
+    void * sweep; /* state of the sweep within the window */
+    slong windows; /* number of grid windows set up so far */
+}
+acb_dirichlet_platt_zeros_iter_struct;
+
+typedef acb_dirichlet_platt_zeros_iter_struct acb_dirichlet_platt_zeros_iter_t[1];
+
+void acb_dirichlet_platt_zeros_iter_init(acb_dirichlet_platt_zeros_iter_t iter,
+    const fmpz_t n, slong A, slong B, const arb_t h, slong J, slong K,
+    slong sigma_grid, slong Ns_max, const arb_t H, slong sigma_interp,
+    slong prec);
+void acb_dirichlet_platt_zeros_iter_clear(acb_dirichlet_platt_zeros_iter_t iter);
+slong acb_dirichlet_platt_zeros_iter_next(arb_ptr res,
+    acb_dirichlet_platt_zeros_iter_t iter, slong len);
+
 /* Discrete Fourier Transform */
 
 void acb_dirichlet_dft_index(acb_ptr w, acb_srcptr v, const dirichlet_group_t G, slong prec);
@@ -10,6 +10,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "acb_dirichlet.h"
 #include "arb_calc.h"
 
@@ -42,12 +43,14 @@ _acb_dirichlet_definite_hardy_z(arb_t res, const arf_t t, slong *pprec)
     return msign;
 }
 
-void
-_refine_hardy_z_zero_illinois(arb_t res, const arf_t ra, const arf_t rb, slong prec)
+static void
+_refine_hardy_z_zero_illinois_stats(arb_t res,
+        acb_dirichlet_hardy_z_zero_stats_struct * stats,
+        const arf_t ra, const arf_t rb, slong prec)
 {
     arf_t a, b, fa, fb, c, fc, t;
     arb_t z;
-    slong k, nmag, abs_tol, wp;
+    slong k, nmag, abs_tol, wp, evals;
     int asign, bsign, csign;
 
     arf_init(a);
@@ -66,6 +69,7 @@ _refine_hardy_z_zero_illinois(arb_t res, const arf_t ra, const arf_t rb, slong p
     abs_tol = nmag - prec - 4;
 
     wp = prec + nmag + 8;
+    evals = 2;
     asign = _acb_dirichlet_definite_hardy_z(z, a, &wp);
     arf_set(fa, arb_midref(z));
     bsign = _acb_dirichlet_definite_hardy_z(z, b, &wp);
@@ -100,6 +104,7 @@ _refine_hardy_z_zero_illinois(arb_t res, const arf_t ra, const arf_t rb, slong p
 
         csign = _acb_dirichlet_definite_hardy_z(z, c, &wp);
         arf_set(fc, arb_midref(z));
+        evals++;
 
         if (csign != bsign)
         {
@@ -133,6 +138,12 @@ _refine_hardy_z_zero_illinois(arb_t res, const arf_t ra, const arf_t rb, slong p
 
     arb_set_interval_arf(res, a, b, prec);
 
+    if (stats != NULL)
+    {
+        stats->prec = FLINT_MAX(stats->prec, wp);
+        stats->evals += evals;
+    }
+
     arf_clear(a);
     arf_clear(b);
     arf_clear(c);
@@ -144,7 +155,15 @@ _refine_hardy_z_zero_illinois(arb_t res, const arf_t ra, const arf_t rb, slong p
 }
 
 void
-_refine_hardy_z_zero_newton(arb_t res, const arf_t ra, const arf_t rb, slong prec)
+_refine_hardy_z_zero_illinois(arb_t res, const arf_t ra, const arf_t rb, slong prec)
+{
+    _refine_hardy_z_zero_illinois_stats(res, NULL, ra, rb, prec);
+}
+
+static void
+_refine_hardy_z_zero_newton_stats(arb_t res,
+        acb_dirichlet_hardy_z_zero_stats_struct * stats,
+        const arf_t ra, const arf_t rb, slong prec)
 {
     acb_t z, zstart;
     acb_ptr v;
@@ -163,7 +182,7 @@ _refine_hardy_z_zero_newton(arb_t res, const arf_t ra, const arf_t rb, slong pre
     extraprec = nbits + 10;
     initial_prec = 3 * nbits + 30;
 
-    _refine_hardy_z_zero_illinois(acb_imagref(zstart), ra, rb, initial_prec);
+    _refine_hardy_z_zero_illinois_stats(acb_imagref(zstart), stats, ra, rb, initial_prec);
     arb_set_d(acb_realref(zstart), 0.5);
     /* Real part is exactly 1/2, but need an epsilon-enclosure (for bounds)
        since we work with the complex function. */
@@ -192,6 +211,11 @@ _refine_hardy_z_zero_newton(arb_t res, const arf_t ra, const arf_t rb, slong pre
         mag_set(err, arb_radref(acb_imagref(z)));
         acb_get_mid(z, z);
         acb_dirichlet_zeta_jet(v, z, 0, 2, wp);
+        if (stats != NULL)
+        {
+            stats->prec = FLINT_MAX(stats->prec, wp);
+            stats->evals++;
+        }
         mag_mul(err, err, der2);
         acb_add_error_mag(v + 1, err);
         acb_div(v, v, v + 1, wp);
@@ -222,7 +246,14 @@ _refine_hardy_z_zero_newton(arb_t res, const arf_t ra, const arf_t rb, slong pre
 }
 
 void
-_acb_dirichlet_refine_hardy_z_zero(arb_t res,
+_refine_hardy_z_zero_newton(arb_t res, const arf_t ra, const arf_t rb, slong prec)
+{
+    _refine_hardy_z_zero_newton_stats(res, NULL, ra, rb, prec);
+}
+
+static void
+_refine_hardy_z_zero_stats(arb_t res,
+        acb_dirichlet_hardy_z_zero_stats_struct * stats,
         const arf_t a, const arf_t b, slong prec)
 {
     slong bits;
@@ -233,11 +264,107 @@ _acb_dirichlet_refine_hardy_z_zero(arb_t res,
     if (bits < prec)
     {
         if (prec < 4 * arf_abs_bound_lt_2exp_si(b) + 40)
-            _refine_hardy_z_zero_illinois(res, a, b, prec);
+            _refine_hardy_z_zero_illinois_stats(res, stats, a, b, prec);
         else
-            _refine_hardy_z_zero_newton(res, a, b, prec);
+            _refine_hardy_z_zero_newton_stats(res, stats, a, b, prec);
     }
 
     arb_set_round(res, res, prec);
 }
 
+void
+_acb_dirichlet_refine_hardy_z_zero(arb_t res,
+        const arf_t a, const arf_t b, slong prec)
+{
+    _refine_hardy_z_zero_stats(res, NULL, a, b, prec);
+}
+
+typedef struct
+{
+    arb_ptr res;
+    acb_dirichlet_hardy_z_zero_stats_struct * stats;
+    arf_interval_srcptr p;
+    slong start;
+    slong step;
+    slong len;
+    slong prec;
+}
+refine_arg_t;
+
+static void
+_refine_range(arb_ptr res, acb_dirichlet_hardy_z_zero_stats_struct * stats,
+    arf_interval_srcptr p, slong start, slong step, slong len, slong prec)
+{
+    slong i;
+
+    for (i = start; i < len; i += step)
+    {
+        if (stats != NULL)
+        {
+            stats[i].prec = 0;
+            stats[i].evals = 0;
+        }
+
+        _refine_hardy_z_zero_stats(res + i,
+            (stats == NULL) ? NULL : stats + i, &p[i].a, &p[i].b, prec);
+
+        if (stats != NULL)
+            stats[i].accuracy = arb_rel_accuracy_bits(res + i);
+    }
+}
+
+static void *
+_refine_worker(void * arg_ptr)
+{
+    refine_arg_t arg = *((refine_arg_t *) arg_ptr);
+
+    _refine_range(arg.res, arg.stats, arg.p,
+        arg.start, arg.step, arg.len, arg.prec);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
+void
+_acb_dirichlet_refine_hardy_z_zeros(arb_ptr res,
+    acb_dirichlet_hardy_z_zero_stats_struct * stats,
+    arf_interval_srcptr p, slong len, slong prec)
+{
+    pthread_t * threads;
+    refine_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_threads <= 1)
+    {
+        _refine_range(res, stats, p, 0, 1, len, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(refine_arg_t) * num_threads);
+
+    /* the cost of a refinement depends on the zero, so the zeros
+       are distributed cyclically rather than in contiguous blocks */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = res;
+        args[i].stats = stats;
+        args[i].p = p;
+        args[i].start = i;
+        args[i].step = num_threads;
+        args[i].len = len;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, _refine_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
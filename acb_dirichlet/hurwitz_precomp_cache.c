@@ -0,0 +1,169 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+#define HURWITZ_PRECOMP_CACHE_MAX_ENTRIES 8
+
+ARB_DLL slong acb_dirichlet_hurwitz_precomp_cache_max_bytes = WORD(1) << 24;
+
+typedef struct
+{
+    acb_dirichlet_hurwitz_precomp_struct pre;
+    slong prec;
+    slong bytes;
+    ulong last_use;
+}
+hurwitz_precomp_cache_entry;
+
+TLS_PREFIX hurwitz_precomp_cache_entry *
+    acb_dirichlet_hurwitz_precomp_cache = NULL;
+TLS_PREFIX slong acb_dirichlet_hurwitz_precomp_cache_num = 0;
+TLS_PREFIX slong acb_dirichlet_hurwitz_precomp_cache_total = 0;
+TLS_PREFIX ulong acb_dirichlet_hurwitz_precomp_cache_clock = 0;
+
+static void
+_precomp_set(acb_dirichlet_hurwitz_precomp_t res,
+        const acb_dirichlet_hurwitz_precomp_t pre)
+{
+    res->deflate = pre->deflate;
+    res->A = pre->A;
+    res->K = pre->K;
+    res->N = pre->N;
+
+    acb_init(&res->s);
+    acb_set(&res->s, &pre->s);
+
+    if (pre->A != 0)
+    {
+        mag_init(&res->err);
+        mag_set(&res->err, &pre->err);
+        res->coeffs = _acb_vec_init(pre->N * pre->K);
+        _acb_vec_set(res->coeffs, pre->coeffs, pre->N * pre->K);
+    }
+}
+
+static slong
+_precomp_allocated_bytes(const acb_dirichlet_hurwitz_precomp_t pre)
+{
+    slong bytes;
+
+    bytes = sizeof(hurwitz_precomp_cache_entry) + acb_allocated_bytes(&pre->s);
+
+    if (pre->A != 0)
+        bytes += _acb_vec_allocated_bytes(pre->coeffs, pre->N * pre->K);
+
+    return bytes;
+}
+
+static void
+_cache_remove(slong i)
+{
+    hurwitz_precomp_cache_entry * cache = acb_dirichlet_hurwitz_precomp_cache;
+    slong num = acb_dirichlet_hurwitz_precomp_cache_num;
+
+    acb_dirichlet_hurwitz_precomp_cache_total -= cache[i].bytes;
+    acb_dirichlet_hurwitz_precomp_clear(&cache[i].pre);
+    cache[i] = cache[num - 1];
+    acb_dirichlet_hurwitz_precomp_cache_num = num - 1;
+}
+
+void
+acb_dirichlet_hurwitz_precomp_cache_clear(void)
+{
+    while (acb_dirichlet_hurwitz_precomp_cache_num > 0)
+        _cache_remove(acb_dirichlet_hurwitz_precomp_cache_num - 1);
+
+    flint_free(acb_dirichlet_hurwitz_precomp_cache);
+    acb_dirichlet_hurwitz_precomp_cache = NULL;
+    acb_dirichlet_hurwitz_precomp_cache_total = 0;
+}
+
+slong
+acb_dirichlet_hurwitz_precomp_cache_bytes(void)
+{
+    return acb_dirichlet_hurwitz_precomp_cache_total;
+}
+
+void
+acb_dirichlet_hurwitz_precomp_init_cached(acb_dirichlet_hurwitz_precomp_t pre,
+        const acb_t s, int deflate, slong A, slong K, slong N, slong prec)
+{
+    hurwitz_precomp_cache_entry * cache;
+    slong i, bytes, lru;
+
+    cache = acb_dirichlet_hurwitz_precomp_cache;
+
+    for (i = 0; i < acb_dirichlet_hurwitz_precomp_cache_num; i++)
+    {
+        if (cache[i].pre.deflate == deflate && cache[i].pre.A == A &&
+            cache[i].pre.K == K && cache[i].pre.N == N &&
+            cache[i].prec >= prec && acb_equal(&cache[i].pre.s, s))
+        {
+            cache[i].last_use = ++acb_dirichlet_hurwitz_precomp_cache_clock;
+            _precomp_set(pre, &cache[i].pre);
+            return;
+        }
+    }
+
+    acb_dirichlet_hurwitz_precomp_init(pre, s, deflate, A, K, N, prec);
+
+    /* nothing is precomputed when A = 0, and a table with an infinite
+       error bound is not worth keeping */
+    if (A == 0 || !mag_is_finite(&pre->err))
+        return;
+
+    bytes = _precomp_allocated_bytes(pre);
+
+    if (bytes > acb_dirichlet_hurwitz_precomp_cache_max_bytes)
+        return;
+
+    if (cache == NULL)
+    {
+        cache = flint_malloc(sizeof(hurwitz_precomp_cache_entry)
+            * HURWITZ_PRECOMP_CACHE_MAX_ENTRIES);
+        acb_dirichlet_hurwitz_precomp_cache = cache;
+        flint_register_cleanup_function(acb_dirichlet_hurwitz_precomp_cache_clear);
+    }
+
+    /* evict the least recently used entries */
+    while (acb_dirichlet_hurwitz_precomp_cache_num > 0 &&
+        (acb_dirichlet_hurwitz_precomp_cache_num
+            == HURWITZ_PRECOMP_CACHE_MAX_ENTRIES ||
+        acb_dirichlet_hurwitz_precomp_cache_total + bytes
+            > acb_dirichlet_hurwitz_precomp_cache_max_bytes))
+    {
+        lru = 0;
+        for (i = 1; i < acb_dirichlet_hurwitz_precomp_cache_num; i++)
+            if (cache[i].last_use < cache[lru].last_use)
+                lru = i;
+
+        _cache_remove(lru);
+    }
+
+    i = acb_dirichlet_hurwitz_precomp_cache_num;
+    _precomp_set(&cache[i].pre, pre);
+    cache[i].prec = prec;
+    cache[i].bytes = bytes;
+    cache[i].last_use = ++acb_dirichlet_hurwitz_precomp_cache_clock;
+    acb_dirichlet_hurwitz_precomp_cache_num = i + 1;
+    acb_dirichlet_hurwitz_precomp_cache_total += bytes;
+}
+
+void
+acb_dirichlet_hurwitz_precomp_init_num_cached(
+        acb_dirichlet_hurwitz_precomp_t pre, const acb_t s, int deflate,
+        double num_eval, slong prec)
+{
+    ulong A, K, N;
+    acb_dirichlet_hurwitz_precomp_choose_param(&A, &K, &N, s, num_eval, prec);
+    acb_dirichlet_hurwitz_precomp_init_cached(pre, s, deflate, A, K, N, prec);
+}
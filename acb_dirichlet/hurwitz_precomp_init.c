@@ -9,14 +9,75 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "acb_dirichlet.h"
 #include "acb_poly.h"
 
+/* row i: multiply by zeta(s+k,a) where a = A + (2*i+1)/(2*N) */
+static void
+_hurwitz_precomp_row(acb_ptr c, const acb_t s, int deflate,
+        slong A, slong K, slong N, slong i, slong prec)
+{
+    acb_t t, a;
+    slong k;
+
+    acb_init(t);
+    acb_init(a);
+
+    acb_set_ui(a, 2 * i + 1);
+    acb_div_ui(a, a, 2 * N, prec);
+    acb_add_ui(a, a, A, prec);
+
+    for (k = 0; k < K; k++)
+    {
+        acb_add_ui(t, s, k, prec);
+
+        if (deflate && k == 0)
+            _acb_poly_zeta_cpx_series(t, t, a, 1, 1, prec);
+        else
+            acb_hurwitz_zeta(t, t, a, prec);
+
+        acb_mul(c + k, c + k, t, prec);
+    }
+
+    acb_clear(t);
+    acb_clear(a);
+}
+
+typedef struct
+{
+    acb_ptr coeffs;
+    acb_srcptr s;
+    int deflate;
+    slong A;
+    slong K;
+    slong N;
+    slong start;
+    slong step;
+    slong prec;
+}
+hurwitz_precomp_arg_t;
+
+static void *
+_hurwitz_precomp_worker(void * arg_ptr)
+{
+    hurwitz_precomp_arg_t arg = *((hurwitz_precomp_arg_t *) arg_ptr);
+    slong i;
+
+    for (i = arg.start; i < arg.N; i += arg.step)
+        _hurwitz_precomp_row(arg.coeffs + i * arg.K, arg.s, arg.deflate,
+            arg.A, arg.K, arg.N, i, arg.prec);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
 void
 acb_dirichlet_hurwitz_precomp_init(acb_dirichlet_hurwitz_precomp_t pre,
         const acb_t s, int deflate, slong A, slong K, slong N, slong prec)
 {
-    slong i, k;
+    slong i, k, num_threads;
 
     pre->deflate = deflate;
     pre->A = A;
@@ -43,11 +104,6 @@ acb_dirichlet_hurwitz_precomp_init(acb_dirichlet_hurwitz_precomp_t pre,
 
     if (mag_is_finite(&pre->err))
     {
-        acb_t t, a;
-
-        acb_init(t);
-        acb_init(a);
-
         /* (-1)^k (s)_k / k! */
         acb_one(pre->coeffs + 0);
         for (k = 1; k < K; k++)
@@ -61,29 +117,44 @@ acb_dirichlet_hurwitz_precomp_init(acb_dirichlet_hurwitz_precomp_t pre,
         for (i = 1; i < N; i++)
             _acb_vec_set(pre->coeffs + i * K, pre->coeffs, K);
 
-        /* zeta(s+k,a) where a = A + (2*i+1)/(2*N) */
-        for (i = 0; i < N; i++)
+        num_threads = FLINT_MIN(flint_get_num_threads(), N);
+
+        if (num_threads <= 1 || N * K < 16)
+        {
+            for (i = 0; i < N; i++)
+                _hurwitz_precomp_row(pre->coeffs + i * K, s, deflate,
+                    A, K, N, i, prec);
+        }
+        else
         {
-            acb_set_ui(a, 2 * i + 1);
-            acb_div_ui(a, a, 2 * N, prec);
-            acb_add_ui(a, a, A, prec);
+            pthread_t * threads;
+            hurwitz_precomp_arg_t * args;
+
+            threads = flint_malloc(sizeof(pthread_t) * num_threads);
+            args = flint_malloc(sizeof(hurwitz_precomp_arg_t) * num_threads);
 
-            for (k = 0; k < K; k++)
+            for (i = 0; i < num_threads; i++)
             {
-                acb_add_ui(t, s, k, prec);
+                args[i].coeffs = pre->coeffs;
+                args[i].s = s;
+                args[i].deflate = deflate;
+                args[i].A = A;
+                args[i].K = K;
+                args[i].N = N;
+                args[i].start = i;
+                args[i].step = num_threads;
+                args[i].prec = prec;
+
+                pthread_create(&threads[i], NULL,
+                    _hurwitz_precomp_worker, &args[i]);
+            }
 
-                if (deflate && k == 0)
-                    _acb_poly_zeta_cpx_series(t, t, a, 1, 1, prec);
-                else
-                    acb_hurwitz_zeta(t, t, a, prec);
+            for (i = 0; i < num_threads; i++)
+                pthread_join(threads[i], NULL);
 
-                acb_mul(pre->coeffs + i * K + k,
-                        pre->coeffs + i * K + k, t, prec);
-            }
+            flint_free(threads);
+            flint_free(args);
         }
-
-        acb_clear(t);
-        acb_clear(a);
     }
 }
 
@@ -1390,13 +1390,9 @@ acb_dirichlet_hardy_z_zeros(arb_ptr res, const fmpz_t n, slong len, slong prec)
     }
     else
     {
-        slong i;
         arf_interval_ptr p = _arf_interval_vec_init(len);
         acb_dirichlet_isolate_hardy_z_zeros(p, n, len);
-        for (i = 0; i < len; i++)
-        {
-            _acb_dirichlet_refine_hardy_z_zero(res + i, &p[i].a, &p[i].b, prec);
-        }
+        _acb_dirichlet_refine_hardy_z_zeros(res, NULL, p, len, prec);
         _arf_interval_vec_clear(p, len);
     }
 }
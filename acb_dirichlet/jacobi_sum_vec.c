@@ -0,0 +1,56 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+/* J(chi1, chi) = sum chi(y) chi1(1-y) is the conjugate of the DFT
+   of conj(chi1(1-y)) */
+void
+acb_dirichlet_jacobi_sum_vec(acb_ptr res, const dirichlet_group_t G, const dirichlet_char_t chi1, slong prec)
+{
+    slong i, len, wp;
+    acb_ptr z, v;
+    dirichlet_char_t x;
+
+    len = G->phi_q;
+
+    if (G->q_even > 1)
+    {
+        _acb_vec_zero(res, len);
+        return;
+    }
+
+    wp = prec + FLINT_BIT_COUNT(G->q);
+
+    z = _acb_vec_init(G->q);
+    v = _acb_vec_init(len);
+    acb_dirichlet_chi_vec(z, G, chi1, G->q, wp);
+
+    dirichlet_char_init(x, G);
+    dirichlet_char_one(x, G);
+    for (i = 0; i < len; i++)
+    {
+        acb_conj(v + i, z + ((G->q + 1 - x->n % G->q) % G->q));
+        dirichlet_char_next(x, G);
+    }
+
+    acb_dirichlet_dft_index(res, v, G, wp);
+
+    for (i = 0; i < len; i++)
+    {
+        acb_conj(res + i, res + i);
+        acb_set_round(res + i, res + i, prec);
+    }
+
+    dirichlet_char_clear(x);
+    _acb_vec_clear(z, G->q);
+    _acb_vec_clear(v, len);
+}
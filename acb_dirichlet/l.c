@@ -25,7 +25,7 @@ acb_dirichlet_l_general(acb_t res, const acb_t s,
     {
         slong wp = prec + n_clog(G->phi_q, 2);
         acb_dirichlet_hurwitz_precomp_t pre;
-        acb_dirichlet_hurwitz_precomp_init_num(pre, s, acb_is_one(s), G->phi_q, wp);
+        acb_dirichlet_hurwitz_precomp_init_num_cached(pre, s, acb_is_one(s), G->phi_q, wp);
         acb_dirichlet_l_hurwitz(res, s, pre, G, chi, prec);
         acb_dirichlet_hurwitz_precomp_clear(pre);
     }
@@ -0,0 +1,229 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "acb_dirichlet.h"
+#include "acb_dft.h"
+
+typedef struct
+{
+    acb_ptr z;
+    acb_ptr res;
+    acb_srcptr qs;
+    const acb_dirichlet_hurwitz_precomp_struct * pre;
+    const acb_dft_prod_struct * prod;
+    const ulong * nr;
+    ulong q;
+    slong phi;
+    slong num;
+    slong start;
+    slong step;
+    int stage;
+    slong prec;
+}
+l_vec_multi_arg_t;
+
+/* z[i phi + j] = conj(q^(-s_i) zeta(s_i, n_j / q)) */
+static void
+_l_vec_multi_residue(acb_ptr z, acb_srcptr qs,
+    const acb_dirichlet_hurwitz_precomp_struct * pre, ulong n, ulong q,
+    slong phi, slong num, slong prec)
+{
+    slong i;
+
+    for (i = 0; i < num; i++)
+    {
+        acb_dirichlet_hurwitz_precomp_eval(z + i * phi, pre + i, n, q, prec);
+        acb_mul(z + i * phi, z + i * phi, qs + i, prec);
+        acb_conj(z + i * phi, z + i * phi);
+    }
+}
+
+static void
+_l_vec_multi_dft(acb_ptr res, acb_srcptr z, const acb_dft_prod_struct * prod,
+    slong phi, slong prec)
+{
+    slong k;
+
+    if (phi == 1)
+        acb_set(res, z);
+    else
+        acb_dft_prod_precomp(res, z, prod, prec);
+
+    for (k = 0; k < phi; k++)
+        acb_conj(res + k, res + k);
+}
+
+static void
+_l_vec_multi_range(const l_vec_multi_arg_t * arg_ptr)
+{
+    l_vec_multi_arg_t arg = *arg_ptr;
+    slong i;
+
+    if (arg.stage == 0)
+    {
+        for (i = arg.start; i < arg.phi; i += arg.step)
+            _l_vec_multi_residue(arg.z + i, arg.qs, arg.pre, arg.nr[i],
+                arg.q, arg.phi, arg.num, arg.prec);
+    }
+    else
+    {
+        for (i = arg.start; i < arg.num; i += arg.step)
+            _l_vec_multi_dft(arg.res + i * arg.phi, arg.z + i * arg.phi,
+                arg.prod, arg.phi, arg.prec);
+    }
+}
+
+static void *
+_l_vec_multi_worker(void * arg_ptr)
+{
+    _l_vec_multi_range((l_vec_multi_arg_t *) arg_ptr);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
+static void
+_l_vec_multi_run(l_vec_multi_arg_t * proto, slong len)
+{
+    pthread_t * threads;
+    l_vec_multi_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_threads <= 1)
+    {
+        proto->start = 0;
+        proto->step = 1;
+        _l_vec_multi_range(proto);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(l_vec_multi_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i] = *proto;
+        args[i].start = i;
+        args[i].step = num_threads;
+
+        pthread_create(&threads[i], NULL, _l_vec_multi_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void
+acb_dirichlet_l_vec_hurwitz_multi(acb_ptr res, acb_srcptr s,
+    const acb_dirichlet_hurwitz_precomp_struct * precomp, slong num,
+    const dirichlet_group_t G, slong prec)
+{
+    acb_dirichlet_hurwitz_precomp_struct * pre;
+    acb_dft_prod_t prod;
+    l_vec_multi_arg_t arg;
+    dirichlet_char_t cn;
+    acb_ptr z, qs;
+    acb_t t;
+    ulong * nr;
+    slong i, j, k, l, phi, * cyc;
+
+    if (num <= 0)
+        return;
+
+    phi = G->phi_q;
+    prec += n_clog(phi, 2);
+
+    /* one precomputation per s, shared by all residues */
+    if (precomp == NULL)
+    {
+        pre = flint_malloc(sizeof(acb_dirichlet_hurwitz_precomp_struct) * num);
+        for (i = 0; i < num; i++)
+            acb_dirichlet_hurwitz_precomp_init_num_cached(pre + i, s + i,
+                acb_is_one(s + i), phi, prec);
+    }
+    else
+    {
+        pre = (acb_dirichlet_hurwitz_precomp_struct *) precomp;
+    }
+
+    acb_init(t);
+    qs = _acb_vec_init(num);
+    z = _acb_vec_init(num * phi);
+    nr = flint_malloc(sizeof(ulong) * phi);
+
+    for (i = 0; i < num; i++)
+    {
+        acb_set_ui(qs + i, G->q);
+        acb_neg(t, s + i);
+        acb_pow(qs + i, qs + i, t, prec);
+    }
+
+    /* residues in Conrey order */
+    dirichlet_char_init(cn, G);
+    dirichlet_char_one(cn, G);
+    j = 0;
+    do {
+        nr[j++] = cn->n;
+    } while (dirichlet_char_next(cn, G) >= 0);
+    dirichlet_char_clear(cn);
+
+    cyc = flint_malloc(G->num * sizeof(slong));
+    for (k = 0, l = G->num - 1; l >= 0; k++, l--)
+        cyc[k] = G->P[k].phi.n;
+    if (phi > 1)
+        acb_dft_prod_init(prod, cyc, G->num, prec);
+
+    arg.z = z;
+    arg.res = res;
+    arg.qs = qs;
+    arg.pre = pre;
+    arg.prod = prod;
+    arg.nr = nr;
+    arg.q = G->q;
+    arg.phi = phi;
+    arg.num = num;
+    arg.prec = prec;
+
+    /* Hurwitz zeta values, split by residue class */
+    arg.stage = 0;
+    _l_vec_multi_run(&arg, phi);
+
+    /* one DFT per s */
+    arg.stage = 1;
+    _l_vec_multi_run(&arg, num);
+
+    /* restore pole for the principal character */
+    for (i = 0; i < num; i++)
+        if (acb_is_one(s + i))
+            acb_indeterminate(res + i * phi);
+
+    if (phi > 1)
+        acb_dft_prod_clear(prod);
+    flint_free(cyc);
+    flint_free(nr);
+    _acb_vec_clear(z, num * phi);
+    _acb_vec_clear(qs, num);
+    acb_clear(t);
+
+    if (precomp == NULL)
+    {
+        for (i = 0; i < num; i++)
+            acb_dirichlet_hurwitz_precomp_clear(pre + i);
+        flint_free(pre);
+    }
+}
@@ -11,6 +11,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "acb_dirichlet.h"
 #include "arb_calc.h"
 
@@ -68,7 +69,7 @@ platt_ctx_init(platt_ctx_t ctx,
     fmpz_set(&ctx->T, T);
     arb_set(&ctx->H, H);
     acb_dirichlet_platt_ws_precomp_init(&ctx->pre, A, H, sigma_interp, prec);
-    acb_dirichlet_platt_multieval(ctx->p, T, A, B, h, J, K, sigma_grid, prec);
+    acb_dirichlet_platt_multieval_threaded(ctx->p, T, A, B, h, J, K, sigma_grid, prec);
 }
 
 static void
@@ -953,24 +954,57 @@ finish:
 }
 
 
-static slong
-_isolate_zeros(arf_interval_ptr res,
-        const platt_ctx_t ctx, const fmpz_t n, slong len, slong prec)
+/*
+ * This structure describes the state of a sweep through the zeros of
+ * f(t) in a single grid window, so that zeros can be isolated in
+ * consecutive batches without rebuilding the list of Gram blocks.
+ */
+typedef struct
 {
-    zz_node_ptr x, y; /* Anchor nodes where N(t) is known */
-    zz_node_ptr u, v; /* For certifying Gram nodes as 'good' */
-    zz_node_ptr p, q;
-    fmpz_t nnext;
-    slong i, k, bound, zn, zc, zeros_count;
+    zz_node_ptr p; /* head of the list */
+    zz_node_ptr x; /* anchor node where N(t) is known */
+    zz_node_ptr y; /* next anchor node, or NULL if not yet certified */
+    zz_node_ptr v; /* forward-most node in the list */
+    slong k; /* number of consecutive good Gram blocks ending at v */
+    fmpz nnext; /* index of the next zero to be isolated */
+}
+zz_sweep_struct;
 
-    fmpz_init(nnext);
-    fmpz_set(nnext, n);
+static void
+zz_sweep_init(zz_sweep_struct *s, const fmpz_t n)
+{
+    s->p = NULL;
+    s->x = NULL;
+    s->y = NULL;
+    s->v = NULL;
+    s->k = 0;
+    fmpz_init_set(&s->nnext, n);
+}
 
-    p = NULL;
-    zeros_count = 0;
-    if (!create_initial_double_superblock(&p, &q, &bound, ctx, n, prec))
+static void
+zz_sweep_clear(zz_sweep_struct *s)
+{
+    delete_list(s->p);
+    s->p = NULL;
+    s->x = NULL;
+    s->y = NULL;
+    s->v = NULL;
+    fmpz_clear(&s->nnext);
+}
+
+/*
+ * Create the initial double superblock around the zero with index
+ * s->nnext and set the first anchor. Returns 0 on failure.
+ */
+static int
+zz_sweep_start(zz_sweep_struct *s, const platt_ctx_t ctx, slong prec)
+{
+    zz_node_ptr x, p, q, u, v;
+    slong k, bound, zn;
+
+    if (!create_initial_double_superblock(&p, &q, &bound, ctx, &s->nnext, prec))
     {
-        goto finish;
+        return 0;
     }
 
     /*
@@ -1017,7 +1051,31 @@ _isolate_zeros(arf_interval_ptr res,
         flint_printf("failed to scan the initial list\n");
         flint_abort();
     }
-    v = u;
+
+    s->p = p;
+    s->x = x;
+    s->y = NULL;
+    s->v = u;
+    s->k = k;
+    return 1;
+}
+
+/*
+ * Isolate up to len consecutive zeros, beginning with the zero with index
+ * s->nnext, and advance the sweep past them. Returns the number of zeros
+ * isolated, which is less than len only if the sweep reached the end of
+ * the grid window (or an evaluation was too imprecise).
+ */
+static slong
+zz_sweep_next(arf_interval_ptr res, zz_sweep_struct *s,
+        const platt_ctx_t ctx, slong len, slong prec)
+{
+    zz_node_ptr u, y;
+    slong i, bound, zn, zc, zeros_count;
+    fmpz_t m;
+
+    fmpz_init(m);
+    zeros_count = 0;
 
     /*
      * Iterate through Gram blocks. The central good Gram point in each
@@ -1027,69 +1085,98 @@ _isolate_zeros(arf_interval_ptr res,
      * is known. As anchor points are certified, isolate the zeros falling
      * between each pair.
      */
-    while (1)
+    while (zeros_count < len)
     {
-        u = v;
-        if (!extend_to_next_good_gram_node(&v, v, ctx, prec))
+        if (s->y == NULL)
         {
-            goto finish;
-        }
-        zn = count_gram_intervals(u, v);
-        for (i = 0; i < LOOPCOUNT && count_sign_changes(u, v) < zn; i++)
-        {
-            if (!intercalate(ctx, u, v, prec))
+            u = s->v;
+            if (!extend_to_next_good_gram_node(&s->v, s->v, ctx, prec))
             {
                 goto finish;
             }
-        }
-        if (count_sign_changes(u, v) >= zn)
-        {
-            k++;
-        }
-        else
-        {
-            k = 0;
-        }
-        bound = acb_dirichlet_turing_method_bound(v->gram);
-        if (k >= 2*bound && fmpz_cmp(x->gram, v->gram) < 0)
-        {
+            zn = count_gram_intervals(u, s->v);
+            for (i = 0; i < LOOPCOUNT && count_sign_changes(u, s->v) < zn; i++)
+            {
+                if (!intercalate(ctx, u, s->v, prec))
+                {
+                    goto finish;
+                }
+            }
+            if (count_sign_changes(u, s->v) >= zn)
+            {
+                s->k++;
+            }
+            else
+            {
+                s->k = 0;
+            }
+            bound = acb_dirichlet_turing_method_bound(s->v->gram);
+            if (s->k < 2*bound || fmpz_cmp(s->x->gram, s->v->gram) >= 0)
+            {
+                continue;
+            }
+
             /* There are exactly zn zeros between the anchor points x and y. */
-            y = scan_to_prev_good_gram_node(v, bound);
+            y = scan_to_prev_good_gram_node(s->v, bound);
             if (!y)
             {
                 flint_printf("failed to scan backwards to anchor point\n");
                 flint_abort();
             }
-            zn = count_gram_intervals(x, y);
-            while (count_sign_changes(x, y) < zn)
+            zn = count_gram_intervals(s->x, y);
+            while (count_sign_changes(s->x, y) < zn)
             {
-                if (!intercalate(ctx, x, y, prec))
+                if (!intercalate(ctx, s->x, y, prec))
                 {
                     goto finish;
                 }
             }
-            zc = count_up_separated_zeros(res + zeros_count,
-                    x, y, nnext, len - zeros_count);
-            if (zc < 0 || zc > len - zeros_count)
-            {
-                flint_printf("unexpected number of isolated zeros\n");
-                flint_abort();
-            }
-            zeros_count += zc;
-            if (zeros_count == len)
-            {
-                goto finish;
-            }
-            fmpz_add_ui(nnext, nnext, zc);
-            x = y;
-            delete_list_to(p, x);
-            p = x;
+            s->y = y;
+        }
+
+        zc = count_up_separated_zeros(res + zeros_count,
+                s->x, s->y, &s->nnext, len - zeros_count);
+        if (zc < 0 || zc > len - zeros_count)
+        {
+            flint_printf("unexpected number of isolated zeros\n");
+            flint_abort();
+        }
+        zeros_count += zc;
+        fmpz_add_ui(&s->nnext, &s->nnext, zc);
+
+        /*
+         * The zeros below the good Gram point g(m) have indices at most
+         * m + 1. Move the anchor forward once they have all been isolated.
+         */
+        fmpz_add_ui(m, s->y->gram, 1);
+        if (zc == 0 || fmpz_cmp(&s->nnext, m) > 0)
+        {
+            s->x = s->y;
+            s->y = NULL;
+            delete_list_to(s->p, s->x);
+            s->p = s->x;
         }
     }
 
 finish:
-    fmpz_clear(nnext);
-    delete_list(p);
+    fmpz_clear(m);
+    return zeros_count;
+}
+
+static slong
+_isolate_zeros(arf_interval_ptr res,
+        const platt_ctx_t ctx, const fmpz_t n, slong len, slong prec)
+{
+    zz_sweep_struct s;
+    slong zeros_count = 0;
+
+    zz_sweep_init(&s, n);
+    if (zz_sweep_start(&s, ctx, prec))
+    {
+        zeros_count = zz_sweep_next(res, &s, ctx, len, prec);
+    }
+    zz_sweep_clear(&s);
+
     return zeros_count;
 }
 
@@ -1224,6 +1311,75 @@ _refine_local_hardy_z_zero_illinois(arb_t res,
     arb_clear(z);
 }
 
+typedef struct
+{
+    arb_ptr res;
+    platt_ctx_srcptr ctx;
+    arf_interval_srcptr p;
+    slong start;
+    slong step;
+    slong len;
+    slong prec;
+}
+refine_local_arg_t;
+
+static void *
+_refine_local_worker(void * arg_ptr)
+{
+    refine_local_arg_t arg = *((refine_local_arg_t *) arg_ptr);
+    slong i;
+
+    for (i = arg.start; i < arg.len; i += arg.step)
+        _refine_local_hardy_z_zero_illinois(arg.res + i, arg.ctx,
+                &arg.p[i].a, &arg.p[i].b, arg.prec);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
+/* refines the isolated zeros in parallel; the grid is only read */
+static void
+_refine_local_hardy_z_zeros(arb_ptr res, const platt_ctx_t ctx,
+        arf_interval_srcptr p, slong len, slong prec)
+{
+    pthread_t * threads;
+    refine_local_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_threads <= 1)
+    {
+        for (i = 0; i < len; i++)
+            _refine_local_hardy_z_zero_illinois(res + i, ctx,
+                    &p[i].a, &p[i].b, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(refine_local_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = res;
+        args[i].ctx = ctx;
+        args[i].p = p;
+        args[i].start = i;
+        args[i].step = num_threads;
+        args[i].len = len;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, _refine_local_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 
 slong
 _acb_dirichlet_platt_local_hardy_z_zeros(
@@ -1232,18 +1388,166 @@ _acb_dirichlet_platt_local_hardy_z_zeros(
         const arb_t h, slong J, slong K, slong sigma_grid,
         slong Ns_max, const arb_t H, slong sigma_interp, slong prec)
 {
-    slong zeros_count, i;
+    slong zeros_count;
     arf_interval_ptr p;
     platt_ctx_t ctx;
     platt_ctx_init(
             ctx, T, A, B, h, J, K, sigma_grid, Ns_max, H, sigma_interp, prec);
     p = _arf_interval_vec_init(len);
     zeros_count = _isolate_zeros(p, ctx, n, len, prec);
-    for (i = 0; i < zeros_count; i++)
-    {
-        _refine_local_hardy_z_zero_illinois(res+i, ctx, &p[i].a, &p[i].b, prec);
-    }
+    _refine_local_hardy_z_zeros(res, ctx, p, zeros_count, prec);
     platt_ctx_clear(ctx);
     _arf_interval_vec_clear(p, len);
     return zeros_count;
 }
+
+
+/*
+ * Set up a grid window for the sweep beginning at the zero with index
+ * iter->n. The window is placed so that this zero lies a quarter of the
+ * way into the window, leaving room behind it for the initial Gram
+ * blocks and most of the window ahead of it for the sweep.
+ */
+static int
+_platt_zeros_iter_new_window(acb_dirichlet_platt_zeros_iter_t iter)
+{
+    platt_ctx_ptr ctx;
+    zz_sweep_struct *s;
+    fmpz_t T, k;
+    arb_t g;
+    int result;
+
+    fmpz_init(T);
+    fmpz_init(k);
+    arb_init(g);
+
+    fmpz_sub_ui(k, &iter->n, 1);
+    acb_dirichlet_gram_point(g, k, NULL, NULL,
+            30 + fmpz_sizeinbase(&iter->n, 2));
+    arf_get_fmpz(T, arb_midref(g), ARF_RND_FLOOR);
+    fmpz_add_si(T, T, iter->B / 4);
+
+    ctx = flint_malloc(sizeof(platt_ctx_struct));
+    platt_ctx_init(ctx, T, iter->A, iter->B, &iter->h, iter->J, iter->K,
+            iter->sigma_grid, iter->Ns_max, &iter->H, iter->sigma_interp,
+            iter->prec);
+
+    s = flint_malloc(sizeof(zz_sweep_struct));
+    zz_sweep_init(s, &iter->n);
+
+    result = zz_sweep_start(s, ctx, iter->prec);
+
+    iter->ctx = ctx;
+    iter->sweep = s;
+    iter->windows++;
+
+    fmpz_clear(T);
+    fmpz_clear(k);
+    arb_clear(g);
+
+    return result;
+}
+
+static void
+_platt_zeros_iter_clear_window(acb_dirichlet_platt_zeros_iter_t iter)
+{
+    if (iter->sweep != NULL)
+    {
+        zz_sweep_clear(iter->sweep);
+        flint_free(iter->sweep);
+        iter->sweep = NULL;
+    }
+    if (iter->ctx != NULL)
+    {
+        platt_ctx_clear(iter->ctx);
+        flint_free(iter->ctx);
+        iter->ctx = NULL;
+    }
+}
+
+void
+acb_dirichlet_platt_zeros_iter_init(acb_dirichlet_platt_zeros_iter_t iter,
+        const fmpz_t n, slong A, slong B,
+        const arb_t h, slong J, slong K, slong sigma_grid,
+        slong Ns_max, const arb_t H, slong sigma_interp, slong prec)
+{
+    if (fmpz_sgn(n) < 1)
+    {
+        flint_printf("nonpositive indices of zeros are not supported\n");
+        flint_abort();
+    }
+
+    fmpz_init_set(&iter->n, n);
+    iter->A = A;
+    iter->B = B;
+    arb_init(&iter->h);
+    arb_set(&iter->h, h);
+    iter->J = J;
+    iter->K = K;
+    iter->sigma_grid = sigma_grid;
+    iter->Ns_max = Ns_max;
+    arb_init(&iter->H);
+    arb_set(&iter->H, H);
+    iter->sigma_interp = sigma_interp;
+    iter->prec = prec;
+    iter->ctx = NULL;
+    iter->sweep = NULL;
+    iter->windows = 0;
+}
+
+void
+acb_dirichlet_platt_zeros_iter_clear(acb_dirichlet_platt_zeros_iter_t iter)
+{
+    _platt_zeros_iter_clear_window(iter);
+    fmpz_clear(&iter->n);
+    arb_clear(&iter->h);
+    arb_clear(&iter->H);
+}
+
+slong
+acb_dirichlet_platt_zeros_iter_next(arb_ptr res,
+        acb_dirichlet_platt_zeros_iter_t iter, slong len)
+{
+    arf_interval_ptr p;
+    slong c, count;
+    int fresh;
+
+    if (len <= 0)
+        return 0;
+
+    p = _arf_interval_vec_init(len);
+    count = 0;
+
+    while (count < len)
+    {
+        fresh = 0;
+        if (iter->ctx == NULL)
+        {
+            fresh = 1;
+            if (!_platt_zeros_iter_new_window(iter))
+            {
+                _platt_zeros_iter_clear_window(iter);
+                break;
+            }
+        }
+
+        c = zz_sweep_next(p, iter->sweep, iter->ctx, len - count, iter->prec);
+
+        _refine_local_hardy_z_zeros(res + count, iter->ctx, p, c, iter->prec);
+
+        count += c;
+        fmpz_add_ui(&iter->n, &iter->n, c);
+
+        /* the sweep reached the end of the window */
+        if (count < len)
+        {
+            _platt_zeros_iter_clear_window(iter);
+            if (fresh && c == 0)
+                break;
+        }
+    }
+
+    _arf_interval_vec_clear(p, len);
+
+    return count;
+}
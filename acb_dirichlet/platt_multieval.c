@@ -9,11 +9,79 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "acb_dirichlet.h"
 #include "arb_hypgeom.h"
 #include "acb_calc.h"
 #include "acb_dft.h"
 
+/*
+    The stages of the multi-evaluation are loops over independent
+    indices. Each stage is written as a function processing the index
+    range [start, stop), and the range is split into contiguous blocks
+    when several threads are used. Every entry is computed by the same
+    sequence of operations as in the serial case, so the output does
+    not depend on the number of threads.
+*/
+typedef void (*platt_range_func_t)(void * data, slong start, slong stop);
+
+typedef struct
+{
+    platt_range_func_t func;
+    void * data;
+    slong start;
+    slong stop;
+}
+platt_range_arg_t;
+
+static void *
+_platt_range_worker(void * arg_ptr)
+{
+    platt_range_arg_t arg = *((platt_range_arg_t *) arg_ptr);
+
+    arg.func(arg.data, arg.start, arg.stop);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
+static void
+_platt_parallel_for(platt_range_func_t func, void * data,
+        slong len, slong num_threads)
+{
+    pthread_t * threads;
+    platt_range_arg_t * args;
+    slong i;
+
+    num_threads = FLINT_MIN(num_threads, len);
+
+    if (num_threads <= 1)
+    {
+        func(data, 0, len);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(platt_range_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].func = func;
+        args[i].data = data;
+        args[i].start = (len * i) / num_threads;
+        args[i].stop = (len * (i + 1)) / num_threads;
+
+        pthread_create(&threads[i], NULL, _platt_range_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 
 static void
 _arb_add_d(arb_t z, const arb_t x, double d, slong prec)
@@ -83,11 +151,26 @@ platt_g_base(acb_t out, const acb_t t, slong prec)
 }
 
 
+typedef struct
+{
+    acb_ptr table;
+    slong A;
+    slong B;
+    arb_srcptr t0;
+    arb_srcptr h;
+    slong K;
+    slong prec;
+}
+platt_g_table_struct;
+
 static void
-platt_g_table(acb_ptr table, slong A, slong B,
-        const arb_t t0, const arb_t h, slong K, slong prec)
+platt_g_table(void * data, slong start, slong stop)
 {
-    slong N = A*B;
+    platt_g_table_struct * d = (platt_g_table_struct *) data;
+    acb_ptr table = d->table;
+    arb_srcptr t0 = d->t0, h = d->h;
+    slong A = d->A, K = d->K, prec = d->prec;
+    slong N = A*d->B;
     slong i, n, k;
     acb_t t, base;
     acb_t gamma_term, exp_term, coeff;
@@ -101,7 +184,7 @@ platt_g_table(acb_ptr table, slong A, slong B,
 
     precomputed_powers = _acb_vec_init(K);
 
-    for (i=0; i<N; i++)
+    for (i=start; i<stop; i++)
     {
         n = i - N/2;
 
@@ -206,12 +289,35 @@ get_smk_index(slong *out, slong B, slong j, slong prec)
 }
 
 
+typedef struct
+{
+    acb_ptr table;
+    arb_srcptr t0;
+    slong A;
+    slong B;
+    slong J;
+    slong K;
+    slong prec;
+}
+platt_smk_struct;
+
+/*
+    Processes the indices j in [start + 1, stop + 1). Several consecutive
+    j can contribute to the same entry m, and m is nondecreasing in j.
+    Both ends of the range are therefore moved forward past any j that
+    shares its m with j - 1, so that the blocks handled by different
+    threads write to disjoint entries, each accumulated in increasing
+    order of j as in the serial case.
+*/
 static void
-platt_smk(acb_ptr table,
-        const arb_t t0, slong A, slong B, slong J, slong K, slong prec)
+platt_smk(void * data, slong start, slong stop)
 {
-    slong j, k, m;
-    slong N = A * B;
+    platt_smk_struct * d = (platt_smk_struct *) data;
+    acb_ptr table = d->table;
+    arb_srcptr t0 = d->t0;
+    slong B = d->B, J = d->J, K = d->K, prec = d->prec;
+    slong j, k, m, m1, j0, j1;
+    slong N = d->A * B;
     acb_ptr row;
     arb_ptr diff_powers;
     arb_t rpi, rsqrtj, um, a, base;
@@ -228,7 +334,32 @@ platt_smk(acb_ptr table,
     arb_const_pi(rpi, prec);
     arb_inv(rpi, rpi, prec);
 
-    for (j = 1; j <= J; j++)
+    j0 = start + 1;
+    j1 = stop + 1;
+
+    if (j0 > 1)
+    {
+        get_smk_index(&m1, B, j0 - 1, prec);
+        for ( ; j0 <= J; j0++)
+        {
+            get_smk_index(&m, B, j0, prec);
+            if (m != m1)
+                break;
+        }
+    }
+
+    if (j1 <= J)
+    {
+        get_smk_index(&m1, B, j1 - 1, prec);
+        for ( ; j1 <= J; j1++)
+        {
+            get_smk_index(&m, B, j1, prec);
+            if (m != m1)
+                break;
+        }
+    }
+
+    for (j = j0; j < j1; j++)
     {
         logjsqrtpi(a, j, prec);
         arb_mul(a, a, rpi, prec);
@@ -268,6 +399,135 @@ platt_smk(acb_ptr table,
 }
 
 
+typedef struct
+{
+    acb_ptr table;
+    slong N;
+    const acb_dft_pre_struct * pre;
+    slong prec;
+}
+platt_row_dft_struct;
+
+static void
+platt_row_dft(void * data, slong start, slong stop)
+{
+    platt_row_dft_struct * d = (platt_row_dft_struct *) data;
+    slong N = d->N;
+    slong i, k;
+    acb_ptr row;
+
+    for (k = start; k < stop; k++)
+    {
+        row = d->table + N*k;
+        for (i = 0; i < N/2; i++)
+        {
+            acb_swap(row + i, row + i + N/2);
+        }
+        acb_dft_precomp(row, row, d->pre, d->prec);
+    }
+}
+
+typedef struct
+{
+    acb_ptr out;
+    acb_srcptr table;
+    acb_srcptr S_table;
+    slong N;
+    const acb_dft_pre_struct * pre;
+    slong prec;
+}
+platt_convolution_struct;
+
+/* writes the first N/2 + 1 entries of the convolution of the k-th rows
+   of table and S_table to out + k*(N/2 + 1) */
+static void
+platt_convolution(void * data, slong start, slong stop)
+{
+    platt_convolution_struct * d = (platt_convolution_struct *) data;
+    slong N = d->N, prec = d->prec;
+    slong i, k;
+    acb_ptr padded_table_row, padded_S_table_row, padded_out_table;
+    acb_ptr fp, gp;
+
+    padded_table_row = _acb_vec_init(N*2);
+    padded_S_table_row = _acb_vec_init(N*2);
+    padded_out_table = _acb_vec_init(N*2);
+    fp = _acb_vec_init(N*2);
+    gp = _acb_vec_init(N*2);
+
+    for (k = start; k < stop; k++)
+    {
+        _acb_vec_zero(padded_table_row, N*2);
+        _acb_vec_zero(padded_S_table_row, N*2);
+        _acb_vec_zero(padded_out_table, N*2);
+
+        _acb_vec_set(padded_table_row, d->table + k*N, N);
+        _acb_vec_set(padded_S_table_row, d->S_table + k*N, N);
+
+        for (i = 1; i < N; i++)
+        {
+            acb_swap(padded_S_table_row + i, padded_S_table_row + N*2 - i);
+        }
+
+        acb_dft_precomp(fp, padded_S_table_row, d->pre, prec);
+        acb_dft_precomp(gp, padded_table_row, d->pre, prec);
+        _acb_vec_kronecker_mul(gp, gp, fp, N*2, prec);
+        acb_dft_inverse_precomp(padded_out_table, gp, d->pre, prec);
+
+        _acb_vec_set(d->out + k*(N/2 + 1), padded_out_table, N/2 + 1);
+    }
+
+    _acb_vec_clear(padded_table_row, N*2);
+    _acb_vec_clear(padded_S_table_row, N*2);
+    _acb_vec_clear(padded_out_table, N*2);
+    _acb_vec_clear(fp, N*2);
+    _acb_vec_clear(gp, N*2);
+}
+
+/* the rows are processed in batches of num_threads, so that only
+   num_threads convolutions of length N/2 + 1 are stored at any time;
+   each batch is added to out_table in row order as in do_convolutions */
+static void
+do_convolutions_threaded(acb_ptr out_table,
+        const acb_ptr table, const acb_ptr S_table,
+        slong N, slong K, slong num_threads, slong prec)
+{
+    slong i, j, k, len;
+    acb_ptr conv;
+    acb_dft_pre_t pre;
+    platt_convolution_struct d;
+
+    num_threads = FLINT_MIN(num_threads, K);
+    conv = _acb_vec_init(num_threads*(N/2 + 1));
+    acb_dft_precomp_init(pre, N*2, prec);
+
+    d.out = conv;
+    d.N = N;
+    d.pre = pre;
+    d.prec = prec;
+
+    for (k = 0; k < K; k += num_threads)
+    {
+        len = FLINT_MIN(num_threads, K - k);
+
+        d.table = table + k*N;
+        d.S_table = S_table + k*N;
+        _platt_parallel_for(platt_convolution, &d, len, num_threads);
+
+        for (j = 0; j < len; j++)
+        {
+            for (i = 0; i <= N/2; i++)
+            {
+                acb_add(out_table + i,
+                        out_table + i, conv + j*(N/2 + 1) + i, prec);
+            }
+        }
+    }
+
+    _acb_vec_clear(conv, num_threads*(N/2 + 1));
+    acb_dft_precomp_clear(pre);
+}
+
 static void
 do_convolutions(acb_ptr out_table,
         const acb_ptr table, const acb_ptr S_table,
@@ -321,15 +581,61 @@ do_convolutions(acb_ptr out_table,
     acb_dft_precomp_clear(pre);
 }
 
+typedef struct
+{
+    acb_ptr out;
+    arb_srcptr t0;
+    arb_srcptr h;
+    slong B;
+    slong prec;
+}
+platt_lemma_32_struct;
+
+static void
+add_lemma_32_error(void * data, slong start, slong stop)
+{
+    platt_lemma_32_struct * d = (platt_lemma_32_struct *) data;
+    slong i;
+    arb_t x, err;
+
+    arb_init(x);
+    arb_init(err);
+
+    for (i = start; i < stop; i++)
+    {
+        arb_set_si(x, i);
+        arb_div_si(x, x, d->B, d->prec);
+        acb_dirichlet_platt_lemma_32(err, d->h, d->t0, x, d->prec);
+        _acb_add_error_arb_mag(d->out + i, err);
+    }
+
+    arb_clear(x);
+    arb_clear(err);
+}
+
+typedef struct
+{
+    arb_ptr out;
+    slong A;
+    slong B;
+    arb_srcptr h;
+    slong prec;
+}
+platt_window_struct;
+
 static void
-remove_gaussian_window(arb_ptr out, slong A, slong B, const arb_t h, slong prec)
+remove_gaussian_window(void * data, slong start, slong stop)
 {
+    platt_window_struct * d = (platt_window_struct *) data;
+    arb_ptr out = d->out;
+    arb_srcptr h = d->h;
+    slong A = d->A, prec = d->prec;
     slong i, n;
-    slong N = A*B;
+    slong N = A*d->B;
     arb_t t, x;
     arb_init(t);
     arb_init(x);
-    for (i = 0; i < N; i++)
+    for (i = start; i < stop; i++)
     {
         n = i - N/2;
         arb_set_si(t, n);
@@ -344,14 +650,20 @@ remove_gaussian_window(arb_ptr out, slong A, slong B, const arb_t h, slong prec)
     arb_clear(x);
 }
 
-void
-acb_dirichlet_platt_multieval(arb_ptr out, const fmpz_t T, slong A, slong B,
-        const arb_t h, slong J, slong K, slong sigma, slong prec)
+static void
+_platt_multieval(arb_ptr out, const fmpz_t T, slong A, slong B,
+        const arb_t h, slong J, slong K, slong sigma,
+        slong num_threads, slong prec)
 {
     slong N = A*B;
     slong i, k;
     acb_ptr table, S_table, out_a, out_b;
     acb_ptr row;
+    platt_g_table_struct g_data;
+    platt_smk_struct smk_data;
+    platt_row_dft_struct dft_data;
+    platt_lemma_32_struct lemma_data;
+    platt_window_struct window_data;
     arb_t t0, t, x, k_factorial, err, ratio, c, xi;
     acb_t z;
     acb_dft_pre_t pre_N;
@@ -375,9 +687,23 @@ acb_dirichlet_platt_multieval(arb_ptr out, const fmpz_t T, slong A, slong B,
     _arb_inv_si(xi, B, prec);
     arb_mul_2exp_si(xi, xi, -1);
 
-    platt_smk(S_table, t0, A, B, J, K, prec);
-
-    platt_g_table(table, A, B, t0, h, K, prec);
+    smk_data.table = S_table;
+    smk_data.t0 = t0;
+    smk_data.A = A;
+    smk_data.B = B;
+    smk_data.J = J;
+    smk_data.K = K;
+    smk_data.prec = prec;
+    _platt_parallel_for(platt_smk, &smk_data, J, num_threads);
+
+    g_data.table = table;
+    g_data.A = A;
+    g_data.B = B;
+    g_data.t0 = t0;
+    g_data.h = h;
+    g_data.K = K;
+    g_data.prec = prec;
+    _platt_parallel_for(platt_g_table, &g_data, N, num_threads);
 
     for (k = 0; k < K; k++)
     {
@@ -385,15 +711,11 @@ acb_dirichlet_platt_multieval(arb_ptr out, const fmpz_t T, slong A, slong B,
         _acb_vec_scalar_add_error_arb_mag(table + N*k, N, err);
     }
 
-    for (k = 0; k < K; k++)
-    {
-        row = table + N*k;
-        for (i = 0; i < N/2; i++)
-        {
-            acb_swap(row + i, row + i + N/2);
-        }
-        acb_dft_precomp(row, row, pre_N, prec);
-    }
+    dft_data.table = table;
+    dft_data.N = N;
+    dft_data.pre = pre_N;
+    dft_data.prec = prec;
+    _platt_parallel_for(platt_row_dft, &dft_data, K, num_threads);
     _acb_vec_scalar_div_ui(table, table, N*K, (ulong) A, prec);
 
     for (k = 0; k < K; k++)
@@ -410,15 +732,17 @@ acb_dirichlet_platt_multieval(arb_ptr out, const fmpz_t T, slong A, slong B,
         _acb_vec_scalar_div_arb(row, row, N, k_factorial, prec);
     }
 
-    do_convolutions(out_a, table, S_table, N, K, prec);
+    if (num_threads > 1 && K > 1)
+        do_convolutions_threaded(out_a, table, S_table, N, K, num_threads, prec);
+    else
+        do_convolutions(out_a, table, S_table, N, K, prec);
 
-    for (i = 0; i < N/2 + 1; i++)
-    {
-        arb_set_si(x, i);
-        arb_div_si(x, x, B, prec);
-        acb_dirichlet_platt_lemma_32(err, h, t0, x, prec);
-        _acb_add_error_arb_mag(out_a + i, err);
-    }
+    lemma_data.out = out_a;
+    lemma_data.t0 = t0;
+    lemma_data.h = h;
+    lemma_data.B = B;
+    lemma_data.prec = prec;
+    _platt_parallel_for(add_lemma_32_error, &lemma_data, N/2 + 1, num_threads);
 
     acb_dirichlet_platt_lemma_B1(err, sigma, t0, h, J, prec);
     _acb_vec_scalar_add_error_arb_mag(out_a, N/2 + 1, err);
@@ -453,7 +777,12 @@ acb_dirichlet_platt_multieval(arb_ptr out, const fmpz_t T, slong A, slong B,
         arb_swap(out + i, acb_realref(out_b + i));
     }
 
-    remove_gaussian_window(out, A, B, h, prec);
+    window_data.out = out;
+    window_data.A = A;
+    window_data.B = B;
+    window_data.h = h;
+    window_data.prec = prec;
+    _platt_parallel_for(remove_gaussian_window, &window_data, N, num_threads);
 
     arb_clear(t0);
     arb_clear(t);
@@ -470,3 +799,19 @@ acb_dirichlet_platt_multieval(arb_ptr out, const fmpz_t T, slong A, slong B,
     _acb_vec_clear(out_b, N);
     acb_dft_precomp_clear(pre_N);
 }
+
+void
+acb_dirichlet_platt_multieval(arb_ptr out, const fmpz_t T, slong A, slong B,
+        const arb_t h, slong J, slong K, slong sigma, slong prec)
+{
+    _platt_multieval(out, T, A, B, h, J, K, sigma, 1, prec);
+}
+
+void
+acb_dirichlet_platt_multieval_threaded(arb_ptr out, const fmpz_t T,
+        slong A, slong B, const arb_t h, slong J, slong K, slong sigma,
+        slong prec)
+{
+    _platt_multieval(out, T, A, B, h, J, K, sigma,
+            flint_get_num_threads(), prec);
+}
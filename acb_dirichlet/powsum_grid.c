@@ -0,0 +1,227 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+#include "acb_dft.h"
+
+static void
+_acb_dirichlet_powsum_grid_naive(acb_ptr res, const arb_t sigma,
+    const arb_t t0, const arb_t h, ulong n, slong num, slong prec)
+{
+    acb_t s;
+    slong k;
+
+    acb_init(s);
+
+    for (k = 0; k < num; k++)
+    {
+        arb_set(acb_realref(s), sigma);
+        arb_mul_si(acb_imagref(s), h, k, 2 * prec + 64);
+        arb_add(acb_imagref(s), acb_imagref(s), t0, 2 * prec + 64);
+        acb_dirichlet_powsum_sieved(res + k, s, n, 1, prec);
+    }
+
+    acb_clear(s);
+}
+
+/* number of Taylor terms r such that x^r / r! < 2^-prec */
+static slong
+_taylor_terms(double x, slong prec)
+{
+    double log2term;
+    slong r;
+
+    log2term = 0.0;
+
+    for (r = 1; r < 4 * prec + 10; r++)
+    {
+        log2term += log(x / r) * 1.4426950408889634074;
+
+        if (log2term < -prec)
+            break;
+    }
+
+    return r;
+}
+
+void
+acb_dirichlet_powsum_grid(acb_ptr res, const arb_t sigma, const arb_t t0,
+    const arb_t h, ulong n, slong num, slong prec)
+{
+    acb_dft_pre_t pre;
+    acb_ptr v, w;
+    acb_t a, c;
+    arb_t tc, scale, twopi_M, logk, y, e;
+    fmpz_t m;
+    mag_t epsmax, abssum, err, tm;
+    slong M, R, k, kc, r, wp, mag_bits;
+    ulong j, prev, idx;
+
+    if (num <= 0)
+        return;
+
+    if (n == 0)
+    {
+        _acb_vec_zero(res, num);
+        return;
+    }
+
+    if (!arb_is_finite(sigma) || !arb_is_finite(t0) || !arb_is_finite(h))
+    {
+        _acb_vec_indeterminate(res, num);
+        return;
+    }
+
+    /* the k-th point is tc + (k - kc) h; offsets lie in [-kc, kc] */
+    kc = num / 2;
+
+    M = 1;
+    while (M < 2 * num)
+        M *= 2;
+
+    /* |(k - kc) eps| <= kc pi / M <= pi / 4 */
+    R = _taylor_terms(0.7853981633974483 + 1e-6, prec + 10);
+
+    if (R >= num || n < 2)
+    {
+        _acb_dirichlet_powsum_grid_naive(res, sigma, t0, h, n, num, prec);
+        return;
+    }
+
+    arb_init(tc);
+    arb_init(scale);
+    arb_init(twopi_M);
+    arb_init(logk);
+    arb_init(y);
+    arb_init(e);
+    acb_init(a);
+    acb_init(c);
+    fmpz_init(m);
+    mag_init(epsmax);
+    mag_init(abssum);
+    mag_init(err);
+    mag_init(tm);
+
+    /* the phases t log(k) and the grid indices h M log(k) / (2 pi) must
+       be resolved to prec bits after the binary point */
+    mag_bits = arf_abs_bound_lt_2exp_si(arb_midref(t0));
+    mag_bits = FLINT_MAX(mag_bits, arf_abs_bound_lt_2exp_si(arb_midref(h))
+        + FLINT_BIT_COUNT(num) + 1);
+    mag_bits = FLINT_MAX(mag_bits, 0);
+    wp = prec + 16 + 2 * FLINT_BIT_COUNT(n) + mag_bits;
+
+    arb_mul_si(tc, h, kc, wp);
+    arb_add(tc, tc, t0, wp);
+
+    arb_const_pi(twopi_M, wp);
+    arb_mul_2exp_si(twopi_M, twopi_M, 1);
+    arb_div_ui(twopi_M, twopi_M, M, wp);
+    arb_div(scale, h, twopi_M, wp);
+
+    v = _acb_vec_init(R * M);
+    w = _acb_vec_init(M);
+
+    /* v[r M + m] = sum over k with h log(k) = 2 pi m / M + eps_k
+       of k^(-sigma - i tc) eps_k^r */
+    prev = 0;
+    for (j = 1; j <= n; j++)
+    {
+        arb_log_ui_from_prev(logk, j, logk, prev, wp);
+        prev = j;
+
+        arb_mul(y, logk, tc, wp);
+        arb_sin_cos(acb_imagref(a), acb_realref(a), y, wp);
+        arb_neg(acb_imagref(a), acb_imagref(a));
+        arb_mul(y, logk, sigma, wp);
+        arb_neg(y, y);
+        arb_exp(y, y, wp);
+        acb_mul_arb(a, a, y, wp);
+
+        acb_get_mag(tm, a);
+        mag_add(abssum, abssum, tm);
+
+        arb_mul(y, logk, scale, wp);
+        arf_get_fmpz(m, arb_midref(y), ARF_RND_NEAR);
+        arb_sub_fmpz(e, y, m, wp);
+        arb_mul(e, e, twopi_M, wp);
+
+        arb_get_mag(tm, e);
+        mag_max(epsmax, epsmax, tm);
+
+        idx = fmpz_fdiv_ui(m, M);
+
+        acb_set(c, a);
+        for (r = 0; r < R; r++)
+        {
+            acb_add(v + r * M + idx, v + r * M + idx, c, wp);
+
+            if (r + 1 < R)
+                acb_mul_arb(c, c, e, wp);
+        }
+    }
+
+    acb_dft_precomp_init(pre, M, wp);
+    for (r = 0; r < R; r++)
+    {
+        acb_dft_precomp(w, v + r * M, pre, wp);
+        for (k = 0; k < M; k++)
+            acb_swap(v + r * M + k, w + k);
+    }
+    acb_dft_precomp_clear(pre);
+
+    /* truncation error: |exp(-i x) - sum_{r<R} (-i x)^r / r!|
+       <= x^R / R! * sum_{i>=0} (x / (R+1))^i with x = kc max |eps| */
+    mag_mul_ui(tm, epsmax, kc);
+    mag_pow_ui(err, tm, R);
+    mag_div_ui(tm, tm, R + 1);
+    mag_geom_series(tm, tm, 0);
+    mag_mul(err, err, tm);
+    mag_rfac_ui(tm, R);
+    mag_mul(err, err, tm);
+    mag_mul(err, err, abssum);
+
+    for (k = 0; k < num; k++)
+    {
+        slong kk = k - kc;
+
+        idx = (kk >= 0) ? kk : kk + M;
+
+        acb_set(c, v + (R - 1) * M + idx);
+        for (r = R - 1; r >= 1; r--)
+        {
+            /* c = c * (-i kk) / r + v[(r-1) M + idx] */
+            acb_mul_si(c, c, kk, wp);
+            acb_div_onei(c, c);
+            acb_div_ui(c, c, r, wp);
+            acb_add(c, c, v + (r - 1) * M + idx, wp);
+        }
+
+        acb_add_error_mag(c, err);
+        acb_set_round(res + k, c, prec);
+    }
+
+    _acb_vec_clear(v, R * M);
+    _acb_vec_clear(w, M);
+
+    arb_clear(tc);
+    arb_clear(scale);
+    arb_clear(twopi_M);
+    arb_clear(logk);
+    arb_clear(y);
+    arb_clear(e);
+    acb_clear(a);
+    acb_clear(c);
+    fmpz_clear(m);
+    mag_clear(epsmax);
+    mag_clear(abssum);
+    mag_clear(err);
+    mag_clear(tm);
+}
@@ -0,0 +1,288 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "acb_dirichlet.h"
+#include "acb_poly.h"
+
+#define POWER(_k) (powers + (((_k)-1)/2) * (len))
+#define DIVISOR(_k) (divisors[((_k)-1)/2])
+
+/* span of a block of odd k; fixed so that the result does not depend
+   on the number of threads */
+#define POWSUM_BLOCK 8192
+
+/* below this length, the serial sieve is used */
+#define POWSUM_THREADED_CUTOFF (4 * POWSUM_BLOCK)
+
+/* u = sum of k^(-s) for odd k in [lo, hi]; stores k^(-s) if 3k <= n */
+static void
+_powsum_sieved_block(acb_ptr u, acb_ptr powers, const slong * divisors,
+    const acb_t s, ulong lo, ulong hi, ulong n, slong len,
+    int integer, int critical_line, slong prec)
+{
+    acb_ptr t, p1, p2;
+    arb_t logk;
+    ulong k, kprev;
+
+    t = _acb_vec_init(len);
+    arb_init(logk);
+
+    _acb_vec_zero(u, len);
+    kprev = 0;
+
+    for (k = lo; k <= hi; k += 2)
+    {
+        if (DIVISOR(k) == 0)
+        {
+            acb_dirichlet_powsum_term(t, logk, &kprev, s, k,
+                integer, critical_line, len, prec);
+        }
+        else
+        {
+            p1 = POWER(DIVISOR(k));
+            p2 = POWER(k / DIVISOR(k));
+
+            if (len == 1)
+                acb_mul(t, p1, p2, prec);
+            else
+                _acb_poly_mullow(t, p1, len, p2, len, len, prec);
+        }
+
+        if (k * 3 <= n)
+            _acb_vec_set(POWER(k), t, len);
+
+        _acb_vec_add(u, u, t, len, prec);
+    }
+
+    _acb_vec_clear(t, len);
+    arb_clear(logk);
+}
+
+typedef struct
+{
+    acb_ptr sums;
+    acb_ptr powers;
+    const slong * divisors;
+    const ulong * ends;
+    acb_srcptr s;
+    ulong n;
+    slong c0;
+    slong c1;
+    slong start;
+    slong step;
+    slong len;
+    int integer;
+    int critical_line;
+    slong prec;
+}
+powsum_sieved_arg_t;
+
+static void
+_powsum_sieved_blocks(const powsum_sieved_arg_t * arg)
+{
+    slong c;
+    ulong lo;
+
+    for (c = arg->c0 + arg->start; c < arg->c1; c += arg->step)
+    {
+        lo = (c == 0) ? 1 : arg->ends[c - 1] + 2;
+
+        _powsum_sieved_block(arg->sums + c * arg->len, arg->powers,
+            arg->divisors, arg->s, lo, arg->ends[c], arg->n, arg->len,
+            arg->integer, arg->critical_line, arg->prec);
+    }
+}
+
+static void *
+_powsum_sieved_worker(void * arg_ptr)
+{
+    _powsum_sieved_blocks((powsum_sieved_arg_t *) arg_ptr);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
+static int
+_ulong_cmp(const void * a, const void * b)
+{
+    ulong x = *((const ulong *) a);
+    ulong y = *((const ulong *) b);
+    return (x < y) ? -1 : (x > y);
+}
+
+void
+acb_dirichlet_powsum_sieved_threaded(acb_ptr z, const acb_t s, ulong n,
+    slong len, slong prec)
+{
+    slong * divisors;
+    slong powers_alloc;
+    slong i, j, c, c0, c1, num_blocks, num_threads;
+    ulong k, ibound, power_of_two, lo, * ends;
+    int critical_line, integer;
+    acb_ptr powers, sums, t, u, x;
+    arb_t logk;
+    pthread_t * threads;
+    powsum_sieved_arg_t * args;
+
+    if (n <= 1)
+    {
+        acb_set_ui(z, n);
+        _acb_vec_zero(z + 1, len - 1);
+        return;
+    }
+
+    if (n < POWSUM_THREADED_CUTOFF)
+    {
+        acb_dirichlet_powsum_sieved(z, s, n, len, prec);
+        return;
+    }
+
+    critical_line = arb_is_exact(acb_realref(s)) &&
+        (arf_cmp_2exp_si(arb_midref(acb_realref(s)), -1) == 0);
+
+    integer = arb_is_zero(acb_imagref(s)) && arb_is_int(acb_realref(s));
+
+    divisors = flint_calloc(n / 2 + 1, sizeof(slong));
+    powers_alloc = (n / 6 + 1) * len;
+    powers = _acb_vec_init(powers_alloc);
+
+    ibound = n_sqrt(n);
+    for (i = 3; i <= ibound; i += 2)
+        if (DIVISOR(i) == 0)
+            for (j = i * i; j <= n; j += 2 * i)
+                DIVISOR(j) = i;
+
+    /* block ends: the odd Horner points (n / 2^j) rounded down to odd
+       numbers, and the ends of fixed-size blocks */
+    num_blocks = 0;
+    ends = flint_malloc(sizeof(ulong) * (n / POWSUM_BLOCK + FLINT_BITS + 2));
+
+    for (power_of_two = 1; power_of_two <= n; power_of_two *= 2)
+    {
+        k = n / power_of_two;
+        k -= (k % 2 == 0);
+        ends[num_blocks++] = k;
+
+        if (power_of_two > n / 2)
+            break;
+    }
+
+    for (k = POWSUM_BLOCK - 1; k < n; k += POWSUM_BLOCK)
+        ends[num_blocks++] = k;
+
+    qsort(ends, num_blocks, sizeof(ulong), _ulong_cmp);
+
+    for (i = j = 0; i < num_blocks; i++)
+        if (j == 0 || ends[i] != ends[j - 1])
+            ends[j++] = ends[i];
+    num_blocks = j;
+
+    sums = _acb_vec_init(num_blocks * len);
+
+    num_threads = flint_get_num_threads();
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(powsum_sieved_arg_t) * num_threads);
+
+    /* process the blocks in waves; a wave may only read the powers
+       k^(-s) with k <= hi / 3 stored by earlier waves */
+    for (c0 = 0; c0 < num_blocks; c0 = c1)
+    {
+        lo = (c0 == 0) ? 1 : ends[c0 - 1] + 2;
+
+        c1 = c0 + 1;
+        while (c1 < num_blocks && ends[c1] / 3 < lo)
+            c1++;
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].sums = sums;
+            args[i].powers = powers;
+            args[i].divisors = divisors;
+            args[i].ends = ends;
+            args[i].s = s;
+            args[i].n = n;
+            args[i].c0 = c0;
+            args[i].c1 = c1;
+            args[i].start = i;
+            args[i].step = FLINT_MIN(num_threads, c1 - c0);
+            args[i].len = len;
+            args[i].integer = integer;
+            args[i].critical_line = critical_line;
+            args[i].prec = prec;
+        }
+
+        if (num_threads <= 1 || c1 - c0 == 1)
+        {
+            _powsum_sieved_blocks(&args[0]);
+        }
+        else
+        {
+            for (i = 0; i < FLINT_MIN(num_threads, c1 - c0); i++)
+                pthread_create(&threads[i], NULL,
+                    _powsum_sieved_worker, &args[i]);
+
+            for (i = 0; i < FLINT_MIN(num_threads, c1 - c0); i++)
+                pthread_join(threads[i], NULL);
+        }
+    }
+
+    flint_free(threads);
+    flint_free(args);
+
+    /* combine the odd sums: z = sum_j 2^(-js) u(n / 2^j) by Horner's rule,
+       where u(m) is the sum over odd k <= m */
+    t = _acb_vec_init(len);
+    u = _acb_vec_init(len);
+    x = _acb_vec_init(len);
+    arb_init(logk);
+
+    k = 0;
+    acb_dirichlet_powsum_term(x, logk, &k, s, 2,
+        integer, critical_line, len, prec);
+
+    power_of_two = 1;
+    while (power_of_two * 2 <= n)
+        power_of_two *= 2;
+
+    _acb_vec_zero(z, len);
+
+    for (c = 0; c < num_blocks; c++)
+    {
+        _acb_vec_add(u, u, sums + c * len, len, prec);
+
+        k = n / power_of_two;
+        k -= (k % 2 == 0);
+
+        while (ends[c] == k && power_of_two != 1)
+        {
+            _acb_poly_mullow(t, z, len, x, len, len, prec);
+            _acb_vec_add(z, t, u, len, prec);
+
+            power_of_two /= 2;
+            k = n / power_of_two;
+            k -= (k % 2 == 0);
+        }
+    }
+
+    _acb_poly_mullow(t, z, len, x, len, len, prec);
+    _acb_vec_add(z, t, u, len, prec);
+
+    flint_free(divisors);
+    flint_free(ends);
+    _acb_vec_clear(powers, powers_alloc);
+    _acb_vec_clear(sums, num_blocks * len);
+    _acb_vec_clear(t, len);
+    _acb_vec_clear(u, len);
+    _acb_vec_clear(x, len);
+    arb_clear(logk);
+}
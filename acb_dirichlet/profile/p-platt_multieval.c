@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "acb_dirichlet.h"
+#include "profiler.h"
+
+static int usage(char *argv[])
+{
+    printf("usage: %s [--threads <num>] [--prec <bits>] [--A <A>] [--B <B>] "
+           "[--J <J>] [--K <K>] [--sigma <sigma>] [--h <h>] [--T <T>]\n", argv[0]);
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    slong i, N, A, B, J, K, sigma, prec, num_threads;
+    double hd;
+    fmpz_t T;
+    arb_t h;
+    arb_ptr v1, v2;
+    int identical;
+
+    A = 8;
+    B = 4096;
+    J = 100000;
+    K = 30;
+    sigma = 63;
+    hd = 176.431;
+    prec = 128;
+    num_threads = 1;
+    fmpz_init(T);
+    fmpz_set_ui(T, 1000000);
+
+    for (i = 1; i < argc; i++)
+    {
+        if (i + 1 >= argc)
+            return usage(argv);
+
+        if (!strcmp(argv[i], "--threads"))
+            num_threads = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--prec"))
+            prec = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--A"))
+            A = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--B"))
+            B = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--J"))
+            J = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--K"))
+            K = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--sigma"))
+            sigma = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--h"))
+            hd = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--T"))
+            fmpz_set_str(T, argv[++i], 10);
+        else
+            return usage(argv);
+    }
+
+    N = A*B;
+    arb_init(h);
+    arb_set_d(h, hd);
+    v1 = _arb_vec_init(N);
+    v2 = _arb_vec_init(N);
+
+    flint_printf("A = %wd, B = %wd, J = %wd, K = %wd, sigma = %wd, prec = %wd\n",
+        A, B, J, K, sigma, prec);
+
+    flint_printf("serial:        ");
+    TIMEIT_ONCE_START
+    acb_dirichlet_platt_multieval(v1, T, A, B, h, J, K, sigma, prec);
+    TIMEIT_ONCE_STOP
+
+    flint_set_num_threads(num_threads);
+
+    flint_printf("%wd threads:     ", num_threads);
+    TIMEIT_ONCE_START
+    acb_dirichlet_platt_multieval_threaded(v2, T, A, B, h, J, K, sigma, prec);
+    TIMEIT_ONCE_STOP
+
+    identical = 1;
+    for (i = 0; i < N; i++)
+        identical = identical && arb_equal(v1 + i, v2 + i);
+    flint_printf("identical output: %s\n", identical ? "yes" : "no");
+
+    _arb_vec_clear(v1, N);
+    _arb_vec_clear(v2, N);
+    arb_clear(h);
+    fmpz_clear(T);
+
+    flint_cleanup();
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+void
+acb_dirichlet_root_number_vec(acb_ptr res, const dirichlet_group_t G, slong prec)
+{
+    slong i, len, wp;
+    arb_t sqrtq;
+    dirichlet_char_t x;
+
+    len = G->phi_q;
+    wp = prec + 10;
+
+    acb_dirichlet_gauss_sum_vec(res, G, wp);
+
+    arb_init(sqrtq);
+    arb_sqrt_ui(sqrtq, G->q, wp);
+
+    dirichlet_char_init(x, G);
+    dirichlet_char_one(x, G);
+    for (i = 0; i < len; i++)
+    {
+        /* epsilon(chi) = G(chi) / (i^p sqrt(q)) */
+        if (dirichlet_conductor_char(G, x) < G->q)
+        {
+            acb_indeterminate(res + i);
+        }
+        else
+        {
+            acb_div_arb(res + i, res + i, sqrtq, prec);
+            if (dirichlet_parity_char(G, x))
+                acb_div_onei(res + i, res + i);
+        }
+        dirichlet_char_next(x, G);
+    }
+
+    dirichlet_char_clear(x);
+    arb_clear(sqrtq);
+}
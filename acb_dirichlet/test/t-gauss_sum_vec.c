@@ -0,0 +1,114 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("gauss_sum_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200 * arb_test_multiplier(); iter++)
+    {
+        dirichlet_group_t G;
+        dirichlet_char_t chi, chi1;
+        acb_ptr g, r, j;
+        acb_t t;
+        slong i, len, prec;
+        ulong q;
+
+        q = 1 + n_randint(state, (iter < 20) ? 20 : 400);
+        prec = 2 + n_randint(state, 200);
+
+        dirichlet_group_init(G, q);
+        dirichlet_char_init(chi, G);
+        dirichlet_char_init(chi1, G);
+        len = G->phi_q;
+
+        g = _acb_vec_init(len);
+        r = _acb_vec_init(len);
+        j = _acb_vec_init(len);
+        acb_init(t);
+
+        dirichlet_char_index(chi1, G, n_randint(state, len));
+
+        acb_dirichlet_gauss_sum_vec(g, G, prec);
+        acb_dirichlet_root_number_vec(r, G, prec);
+        acb_dirichlet_jacobi_sum_vec(j, G, chi1, prec);
+
+        dirichlet_char_one(chi, G);
+        for (i = 0; i < len; i++)
+        {
+            acb_dirichlet_gauss_sum(t, G, chi, prec);
+
+            if (!acb_overlaps(g + i, t))
+            {
+                flint_printf("FAIL: G(chi_%wu(%wu))\n\n", q, chi->n);
+                flint_printf("vec = "); acb_printd(g + i, 30); flint_printf("\n\n");
+                flint_printf("gauss_sum = "); acb_printd(t, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+
+            if (q > 1 && prec > 20 && !acb_contains_zero(t) && acb_rel_accuracy_bits(g + i) < prec - 20)
+            {
+                flint_printf("FAIL: accuracy G(chi_%wu(%wu))\n\n", q, chi->n);
+                flint_printf("prec = %wd, vec = ", prec); acb_printd(g + i, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+
+            if (q > 2 && dirichlet_conductor_char(G, chi) == q)
+            {
+                acb_dirichlet_root_number(t, G, chi, prec);
+
+                if (!acb_overlaps(r + i, t))
+                {
+                    flint_printf("FAIL: eps(chi_%wu(%wu))\n\n", q, chi->n);
+                    flint_printf("vec = "); acb_printd(r + i, 30); flint_printf("\n\n");
+                    flint_printf("root_number = "); acb_printd(t, 30); flint_printf("\n\n");
+                    flint_abort();
+                }
+            }
+
+            if (q > 1)
+            {
+                acb_dirichlet_jacobi_sum(t, G, chi1, chi, prec);
+
+                if (!acb_overlaps(j + i, t))
+                {
+                    flint_printf("FAIL: J(chi_%wu(%wu), chi_%wu(%wu))\n\n", q, chi1->n, q, chi->n);
+                    flint_printf("vec = "); acb_printd(j + i, 30); flint_printf("\n\n");
+                    flint_printf("jacobi_sum = "); acb_printd(t, 30); flint_printf("\n\n");
+                    flint_abort();
+                }
+            }
+
+            dirichlet_char_next(chi, G);
+        }
+
+        _acb_vec_clear(g, len);
+        _acb_vec_clear(r, len);
+        _acb_vec_clear(j, len);
+        acb_clear(t);
+        dirichlet_char_clear(chi);
+        dirichlet_char_clear(chi1);
+        dirichlet_group_clear(G);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("hurwitz_precomp_cached....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 500 * arb_test_multiplier(); iter++)
+    {
+        acb_t s, z1, z2;
+        ulong p, q;
+        slong prec, A, K, N, i;
+        acb_dirichlet_hurwitz_precomp_t pre1, pre2;
+        int deflate;
+
+        prec = 2 + n_randint(state, 100);
+        A = 1 + n_randint(state, 3);
+        K = 1 + n_randint(state, 10);
+        N = 1 + n_randint(state, 10);
+        deflate = (n_randint(state, 3) == 0);
+
+        if (n_randint(state, 10) == 0)
+            acb_dirichlet_hurwitz_precomp_cache_max_bytes = n_randint(state, 100000);
+        else
+            acb_dirichlet_hurwitz_precomp_cache_max_bytes = WORD(1) << 24;
+
+        acb_init(s);
+        acb_init(z1);
+        acb_init(z2);
+
+        /* few distinct s, so that the cache gets hits */
+        acb_set_si(s, n_randint(state, 4));
+        acb_div_ui(s, s, 3, 53);
+        arb_set_ui(acb_imagref(s), n_randint(state, 2));
+
+        /* serial and threaded tables must agree */
+        flint_set_num_threads(1);
+        acb_dirichlet_hurwitz_precomp_init(pre1, s, deflate, A, K, N, prec);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_dirichlet_hurwitz_precomp_init_cached(pre2, s, deflate, A, K, N, prec);
+
+        if (acb_dirichlet_hurwitz_precomp_cache_bytes() >
+                acb_dirichlet_hurwitz_precomp_cache_max_bytes)
+        {
+            flint_printf("FAIL (cache size)\n\n");
+            flint_printf("bytes = %wd, max = %wd\n\n",
+                acb_dirichlet_hurwitz_precomp_cache_bytes(),
+                acb_dirichlet_hurwitz_precomp_cache_max_bytes);
+            flint_abort();
+        }
+
+        if (pre2->A != A || pre2->K != K || pre2->N != N ||
+            pre2->deflate != deflate || !acb_equal(&pre2->s, s))
+        {
+            flint_printf("FAIL (parameters)\n\n");
+            flint_abort();
+        }
+
+        for (i = 0; i < 10; i++)
+        {
+            q = 1 + n_randint(state, 1000);
+            p = 1 + n_randint(state, q);
+
+            acb_dirichlet_hurwitz_precomp_eval(z1, pre1, p, q, prec);
+            acb_dirichlet_hurwitz_precomp_eval(z2, pre2, p, q, prec);
+
+            if (!acb_overlaps(z1, z2))
+            {
+                flint_printf("FAIL (overlap)\n\n");
+                flint_printf("s = "); acb_printn(s, 50, 0); flint_printf("\n\n");
+                flint_printf("A = %wd  K = %wd  N = %wd\n\n", A, K, N);
+                flint_printf("p = %wu  q = %wu\n\n", p, q);
+                flint_printf("z1 = "); acb_printn(z1, 50, 0); flint_printf("\n\n");
+                flint_printf("z2 = "); acb_printn(z2, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_dirichlet_hurwitz_precomp_clear(pre2);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_dirichlet_hurwitz_precomp_init(pre2, s, deflate, A, K, N, prec);
+
+        for (i = 0; mag_is_finite(&pre1->err) && i < N * K; i++)
+        {
+            if (!acb_overlaps(pre1->coeffs + i, pre2->coeffs + i))
+            {
+                flint_printf("FAIL (threaded table)\n\n");
+                flint_printf("s = "); acb_printn(s, 50, 0); flint_printf("\n\n");
+                flint_printf("A = %wd  K = %wd  N = %wd  i = %wd\n\n", A, K, N, i);
+                flint_abort();
+            }
+        }
+
+        acb_dirichlet_hurwitz_precomp_clear(pre1);
+        acb_dirichlet_hurwitz_precomp_clear(pre2);
+
+        acb_clear(s);
+        acb_clear(z1);
+        acb_clear(z2);
+    }
+
+    acb_dirichlet_hurwitz_precomp_cache_clear();
+
+    if (acb_dirichlet_hurwitz_precomp_cache_bytes() != 0)
+    {
+        flint_printf("FAIL (cache clear)\n\n");
+        flint_abort();
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
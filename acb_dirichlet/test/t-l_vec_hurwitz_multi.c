@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("l_vec_hurwitz_multi....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        ulong q;
+        slong i, j, num, prec;
+        dirichlet_group_t G;
+        acb_ptr s, v, w;
+        acb_dirichlet_hurwitz_precomp_struct * pre;
+        int use_pre;
+
+        prec = 50 + n_randint(state, 50);
+        q = 1 + n_randint(state, 50);
+        num = 1 + n_randint(state, 4);
+        use_pre = n_randint(state, 2);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        dirichlet_group_init(G, q);
+
+        s = _acb_vec_init(num);
+        v = _acb_vec_init(num * G->phi_q);
+        w = _acb_vec_init(G->phi_q);
+        pre = flint_malloc(sizeof(acb_dirichlet_hurwitz_precomp_struct) * num);
+
+        for (i = 0; i < num; i++)
+        {
+            if (n_randint(state, 4) == 0)
+            {
+                acb_set_si(s + i, 2 + n_randint(state, 3));
+            }
+            else
+            {
+                arb_set_d(acb_realref(s + i), 0.5);
+                arb_set_ui(acb_imagref(s + i), n_randint(state, 100));
+                arb_div_ui(acb_imagref(s + i), acb_imagref(s + i), 7, prec);
+            }
+
+            acb_dirichlet_hurwitz_precomp_init_num(pre + i, s + i,
+                acb_is_one(s + i), num * G->phi_q, prec);
+        }
+
+        acb_dirichlet_l_vec_hurwitz_multi(v, s, use_pre ? pre : NULL,
+            num, G, prec);
+
+        for (i = 0; i < num; i++)
+        {
+            acb_dirichlet_l_vec_hurwitz(w, s + i, NULL, G, prec);
+
+            for (j = 0; j < G->phi_q; j++)
+            {
+                if (!acb_overlaps(w + j, v + i * G->phi_q + j) ||
+                    (acb_rel_accuracy_bits(v + i * G->phi_q + j) <
+                        acb_rel_accuracy_bits(w + j) - 8))
+                {
+                    flint_printf("FAIL\n\n");
+                    flint_printf("q = %wu, i = %wd, j = %wd\n\n", q, i, j);
+                    flint_printf("s = "); acb_printd(s + i, 20); flint_printf("\n\n");
+                    flint_printf("single = "); acb_printd(w + j, 20); flint_printf("\n\n");
+                    flint_printf("multi = "); acb_printd(v + i * G->phi_q + j, 20); flint_printf("\n\n");
+                    flint_abort();
+                }
+            }
+        }
+
+        for (i = 0; i < num; i++)
+            acb_dirichlet_hurwitz_precomp_clear(pre + i);
+        flint_free(pre);
+
+        _acb_vec_clear(s, num);
+        _acb_vec_clear(v, num * G->phi_q);
+        _acb_vec_clear(w, G->phi_q);
+        dirichlet_group_clear(G);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
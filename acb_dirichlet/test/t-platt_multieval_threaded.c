@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("platt_multieval_threaded....");
+    fflush(stdout);
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10 * arb_test_multiplier(); iter++)
+    {
+        slong i, prec;
+        ulong A, B, N, J, K;
+        slong sigma, Tbits;
+        fmpz_t T;
+        arb_t h;
+        arb_ptr v1, v2;
+
+        prec = 2 + n_randint(state, 300);
+        sigma = 1 + 2*(1 + n_randint(state, 100));
+        J = 1 + n_randint(state, 100);
+        K = 1 + n_randint(state, 20);
+        A = 1 + n_randint(state, 10);
+        B = 1 + n_randint(state, 10);
+        if (n_randint(state, 2))
+            A *= 2;
+        else
+            B *= 2;
+        N = A*B;
+
+        fmpz_init(T);
+        Tbits = 5 + n_randint(state, 15);
+        fmpz_set_ui(T, n_randtest_bits(state, Tbits));
+
+        arb_init(h);
+        arb_set_si(h, 1 + n_randint(state, 20000));
+        arb_div_si(h, h, 1000, prec);
+
+        v1 = _arb_vec_init(N);
+        v2 = _arb_vec_init(N);
+
+        acb_dirichlet_platt_multieval(v1, T, A, B, h, J, K, sigma, prec);
+        flint_set_num_threads(1 + n_randint(state, 5));
+        acb_dirichlet_platt_multieval_threaded(v2, T, A, B, h, J, K, sigma, prec);
+
+        for (i = 0; i < N; i++)
+        {
+            /* the same operations are performed in the same order */
+            if (!arf_equal(arb_midref(v1 + i), arb_midref(v2 + i)) ||
+                !arb_overlaps(v1 + i, v2 + i))
+            {
+                flint_printf("FAIL: serial and threaded differ\n\n");
+                flint_printf("iter = %wd  prec = %wd  i = %wd\n\n", iter, prec, i);
+                flint_printf("sigma = %wd\n\n", sigma);
+                flint_printf("A = %wu  B = %wu  J = %wu  K = %wu\n\n", A, B, J, K);
+                flint_printf("T = "); fmpz_print(T); flint_printf("\n\n");
+                flint_printf("h = "); arb_printn(h, 30, 0); flint_printf("\n\n");
+                flint_printf("v1 = "); arb_printn(v1 + i, 30, 0); flint_printf("\n\n");
+                flint_printf("v2 = "); arb_printn(v2 + i, 30, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        flint_set_num_threads(1);
+
+        arb_clear(h);
+        fmpz_clear(T);
+        _arb_vec_clear(v1, N);
+        _arb_vec_clear(v2, N);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,108 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("platt_zeros_iter....");
+    fflush(stdout);
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2 * arb_test_multiplier(); iter++)
+    {
+        acb_dirichlet_platt_zeros_iter_t it;
+        slong A, B, J, K, sigma_grid, Ns_max, sigma_interp;
+        arb_t h, H;
+        fmpz_t n;
+        arb_ptr pa, pb;
+        slong i, c, count, total, prec;
+
+        total = 150;
+        prec = 64 + n_randint(state, 64);
+
+        arb_init(h);
+        arb_init(H);
+        fmpz_init(n);
+        pa = _arb_vec_init(total);
+        pb = _arb_vec_init(total);
+
+        /* same tuning parameters as in t-platt_local_hardy_z_zeros */
+        fmpz_set_si(n, 10142 + n_randint(state, 100));
+        A = 8;
+        B = 128;
+        J = 1000;
+        K = 30;
+        sigma_grid = 63;
+        arb_set_d(h, 4.5);
+        Ns_max = 200;
+        sigma_interp = 21;
+        arb_one(H);
+
+        acb_dirichlet_platt_zeros_iter_init(it, n, A, B, h, J, K,
+                sigma_grid, Ns_max, H, sigma_interp, prec);
+
+        /* request the zeros in batches of random size */
+        count = 0;
+        while (count < total)
+        {
+            c = 1 + n_randint(state, 40);
+            c = FLINT_MIN(c, total - count);
+            if (acb_dirichlet_platt_zeros_iter_next(pa + count, it, c) != c)
+            {
+                flint_printf("FAIL: not enough zeros were isolated\n\n");
+                flint_printf("count = %wd\n\n", count);
+                flint_abort();
+            }
+            count += c;
+        }
+
+        fmpz_add_ui(n, n, total);
+        if (!fmpz_equal(n, &it->n) || it->windows < 2)
+        {
+            flint_printf("FAIL: iterator state\n\n");
+            flint_printf("windows = %wd\n\n", it->windows);
+            flint_abort();
+        }
+        fmpz_sub_ui(n, n, total);
+
+        acb_dirichlet_hardy_z_zeros(pb, n, total, prec);
+
+        for (i = 0; i < total; i++)
+        {
+            if (!arb_overlaps(pa + i, pb + i))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("observed[%wd] = ", i);
+                arb_printd(pa + i, 20); flint_printf("\n\n");
+                flint_printf("expected[%wd] = ", i);
+                arb_printd(pb + i, 20); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_dirichlet_platt_zeros_iter_clear(it);
+        arb_clear(h);
+        arb_clear(H);
+        fmpz_clear(n);
+        _arb_vec_clear(pa, total);
+        _arb_vec_clear(pb, total);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("powsum_grid....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr res;
+        acb_t s, z;
+        arb_t sigma, t0, h;
+        ulong n;
+        slong k, num, prec;
+
+        prec = 2 + n_randint(state, 100);
+        num = 1 + n_randint(state, 150);
+        n = n_randint(state, 200);
+
+        res = _acb_vec_init(num);
+        acb_init(s);
+        acb_init(z);
+        arb_init(sigma);
+        arb_init(t0);
+        arb_init(h);
+
+        if (n_randint(state, 2))
+            arb_set_d(sigma, 0.5);
+        else
+            arb_randtest(sigma, state, 2 + n_randint(state, 100), 2);
+
+        arb_randtest(t0, state, 2 + n_randint(state, 100), 4);
+        arb_add_ui(t0, t0, n_randtest(state) % 100000, 100);
+        arb_randtest(h, state, 2 + n_randint(state, 100), 2);
+
+        acb_dirichlet_powsum_grid(res, sigma, t0, h, n, num, prec);
+
+        for (k = 0; k < num; k++)
+        {
+            arb_set(acb_realref(s), sigma);
+            arb_mul_si(acb_imagref(s), h, k, 2 * prec + 64);
+            arb_add(acb_imagref(s), acb_imagref(s), t0, 2 * prec + 64);
+
+            acb_dirichlet_powsum_sieved(z, s, n, 1, prec);
+
+            if (!acb_overlaps(res + k, z))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("iter = %wd, n = %wu, num = %wd, k = %wd\n\n",
+                    iter, n, num, k);
+                flint_printf("s = "); acb_printn(s, 50, 0); flint_printf("\n\n");
+                flint_printf("res = "); acb_printn(res + k, 50, 0); flint_printf("\n\n");
+                flint_printf("z = "); acb_printn(z, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        for (k = 0; k < num; k++)
+        {
+            if (!acb_is_finite(res + k))
+            {
+                flint_printf("FAIL: not finite\n\n");
+                flint_printf("iter = %wd, n = %wu, num = %wd, k = %wd\n\n",
+                    iter, n, num, k);
+                flint_printf("res = "); acb_printn(res + k, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(res, num);
+        acb_clear(s);
+        acb_clear(z);
+        arb_clear(sigma);
+        arb_clear(t0);
+        arb_clear(h);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
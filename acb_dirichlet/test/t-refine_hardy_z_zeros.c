@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("refine_hardy_z_zeros....");
+    fflush(stdout);
+    flint_randinit(state);
+
+    for (iter = 0; iter < 20 * arb_test_multiplier(); iter++)
+    {
+        arf_interval_ptr p;
+        acb_dirichlet_hardy_z_zero_stats_struct * stats;
+        arb_ptr r1, r2;
+        fmpz_t n;
+        slong i, len, prec;
+
+        len = 1 + n_randint(state, 20);
+        prec = 2 + n_randint(state, 300);
+
+        fmpz_init(n);
+        fmpz_set_ui(n, 1 + n_randint(state, 1000));
+
+        p = _arf_interval_vec_init(len);
+        stats = flint_malloc(sizeof(acb_dirichlet_hardy_z_zero_stats_struct) * len);
+        r1 = _arb_vec_init(len);
+        r2 = _arb_vec_init(len);
+
+        acb_dirichlet_isolate_hardy_z_zeros(p, n, len);
+
+        for (i = 0; i < len; i++)
+            _acb_dirichlet_refine_hardy_z_zero(r1 + i, &p[i].a, &p[i].b, prec);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        _acb_dirichlet_refine_hardy_z_zeros(r2, n_randint(state, 2) ? stats : NULL,
+            p, len, prec);
+        _acb_dirichlet_refine_hardy_z_zeros(r2, stats, p, len, prec);
+        flint_set_num_threads(1);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(r1 + i, r2 + i) ||
+                stats[i].accuracy != arb_rel_accuracy_bits(r2 + i) ||
+                stats[i].evals < 0 ||
+                (stats[i].evals > 0 && stats[i].prec < prec))
+            {
+                flint_printf("FAIL (i = %wd)\n\n", i);
+                flint_printf("n = "); fmpz_print(n); flint_printf("  prec = %wd\n\n", prec);
+                flint_printf("r1 = "); arb_printd(r1 + i, 30); flint_printf("\n\n");
+                flint_printf("r2 = "); arb_printd(r2 + i, 30); flint_printf("\n\n");
+                flint_printf("prec = %wd, evals = %wd, accuracy = %wd\n\n",
+                    stats[i].prec, stats[i].evals, stats[i].accuracy);
+                flint_abort();
+            }
+        }
+
+        fmpz_clear(n);
+        _arf_interval_vec_clear(p, len);
+        flint_free(stats);
+        _arb_vec_clear(r1, len);
+        _arb_vec_clear(r2, len);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
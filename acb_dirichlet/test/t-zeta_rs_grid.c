@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("zeta_rs_grid....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 50 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr res;
+        acb_t s, z;
+        arb_t sigma, t0, h;
+        slong k, num, prec, K;
+
+        prec = 2 + n_randint(state, 100);
+        num = 1 + n_randint(state, 100);
+        K = n_randint(state, 10);
+
+        res = _acb_vec_init(num);
+        acb_init(s);
+        acb_init(z);
+        arb_init(sigma);
+        arb_init(t0);
+        arb_init(h);
+
+        if (n_randint(state, 2))
+            arb_set_d(sigma, 0.5);
+        else
+            arb_randtest(sigma, state, 2 + n_randint(state, 100), 2);
+
+        arb_randtest(t0, state, 2 + n_randint(state, 100), 2);
+        arb_add_ui(t0, t0, 20 + n_randtest(state) % 100000, 100);
+        arb_randtest(h, state, 2 + n_randint(state, 100), 2);
+        arb_mul_2exp_si(h, h, -(slong) n_randint(state, 8));
+
+        if (n_randint(state, 2))
+        {
+            mag_zero(arb_radref(sigma));
+            mag_zero(arb_radref(t0));
+            mag_zero(arb_radref(h));
+        }
+
+        acb_dirichlet_zeta_rs_grid(res, sigma, t0, h, num, K, prec);
+
+        for (k = 0; k < num; k++)
+        {
+            arb_set(acb_realref(s), sigma);
+            arb_mul_si(acb_imagref(s), h, k, 2 * prec + 64);
+            arb_add(acb_imagref(s), acb_imagref(s), t0, 2 * prec + 64);
+
+            acb_zeta(z, s, prec);
+
+            if (!acb_overlaps(res + k, z))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("iter = %wd, num = %wd, k = %wd, K = %wd\n\n",
+                    iter, num, k, K);
+                flint_printf("s = "); acb_printn(s, 50, 0); flint_printf("\n\n");
+                flint_printf("res = "); acb_printn(res + k, 50, 0); flint_printf("\n\n");
+                flint_printf("z = "); acb_printn(z, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(res, num);
+        acb_clear(s);
+        acb_clear(z);
+        arb_clear(sigma);
+        arb_clear(t0);
+        arb_clear(h);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,257 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+/* X(s) = (2 pi)^s rgamma(s) / (2 cos(pi s / 2)) */
+static void
+_acb_dirichlet_zeta_rs_x(acb_t X, const acb_t s, slong prec)
+{
+    acb_t t;
+    acb_init(t);
+
+    acb_rgamma(X, s, prec);
+    acb_const_pi(t, prec);
+    acb_mul_2exp_si(t, t, 1);
+    acb_pow(t, t, s, prec);
+    acb_mul(X, X, t, prec);
+    acb_mul_2exp_si(t, s, -1);
+    acb_cos_pi(t, t, prec);
+    acb_mul_2exp_si(t, t, 1);
+    acb_div(X, X, t, prec);
+
+    acb_clear(t);
+}
+
+/* sum_{n < j <= N} j^(-s) */
+static void
+_acb_dirichlet_powsum_range(acb_t res, const acb_t s, ulong n, ulong N,
+    slong prec)
+{
+    acb_t u;
+    arb_t log_prev;
+    ulong j, prev;
+    int critical_line;
+
+    acb_zero(res);
+
+    if (N <= n)
+        return;
+
+    acb_init(u);
+    arb_init(log_prev);
+
+    critical_line = arb_is_exact(acb_realref(s)) &&
+        (arf_cmp_2exp_si(arb_midref(acb_realref(s)), -1) == 0);
+
+    prev = 0;
+    for (j = n + 1; j <= N; j++)
+    {
+        acb_dirichlet_powsum_term(u, log_prev, &prev, s, j, 0,
+            critical_line, 1, prec);
+        acb_add(res, res, u, prec);
+    }
+
+    acb_clear(u);
+    arb_clear(log_prev);
+}
+
+static void
+_acb_dirichlet_zeta_rs_grid_naive(acb_ptr res, const arb_t sigma,
+    const arb_t t0, const arb_t h, slong num, slong K, slong prec)
+{
+    acb_t s;
+    slong k;
+
+    acb_init(s);
+
+    for (k = 0; k < num; k++)
+    {
+        arb_set(acb_realref(s), sigma);
+        arb_mul_si(acb_imagref(s), h, k, 2 * prec + 64);
+        arb_add(acb_imagref(s), acb_imagref(s), t0, 2 * prec + 64);
+        acb_dirichlet_zeta_rs(res + k, s, K, prec);
+    }
+
+    acb_clear(s);
+}
+
+void
+acb_dirichlet_zeta_rs_grid(acb_ptr res, const arb_t sigma, const arb_t t0,
+    const arb_t h, slong num, slong K, slong prec)
+{
+    acb_ptr R1, R2, S1, S2;
+    acb_t s, u, X;
+    arb_t sm, tm, hm, sm2;
+    fmpz_t N;
+    ulong * Nk;
+    ulong N_lo;
+    mag_t rad, err, err2;
+    slong k, wp, wp1, wpt;
+    int half, ok;
+    double t_lo, t_hi;
+
+    if (num <= 0)
+        return;
+
+    t_lo = arf_get_d(arb_midref(t0), ARF_RND_DOWN);
+    t_hi = t_lo + (num - 1) * arf_get_d(arb_midref(h), ARF_RND_DOWN);
+    t_lo = FLINT_MIN(t_lo, t_hi);
+
+    /* the grid must stay in the upper half-plane, where the RS main sums
+       can be shared between the points */
+    if (num < 2 || !(t_lo > 10 && t_hi < 1e40) ||
+        !arb_is_finite(sigma) || !arb_is_finite(h))
+    {
+        _acb_dirichlet_zeta_rs_grid_naive(res, sigma, t0, h, num, K, prec);
+        return;
+    }
+
+    arb_init(sm);
+    arb_init(sm2);
+    arb_init(tm);
+    arb_init(hm);
+    acb_init(s);
+    acb_init(u);
+    acb_init(X);
+    fmpz_init(N);
+    mag_init(rad);
+    mag_init(err);
+    mag_init(err2);
+
+    R1 = _acb_vec_init(num);
+    R2 = _acb_vec_init(num);
+    S1 = _acb_vec_init(num);
+    S2 = _acb_vec_init(num);
+    Nk = flint_malloc(sizeof(ulong) * num);
+
+    /* evaluate at the midpoints; the radii are added at the end */
+    arb_set_arf(sm, arb_midref(sigma));
+    arb_set_arf(tm, arb_midref(t0));
+    arb_set_arf(hm, arb_midref(h));
+
+    half = (arf_cmp_2exp_si(arb_midref(sm), -1) == 0);
+
+    /* 1 - sigma */
+    arb_sub_ui(sm2, sm, 1, ARF_PREC_EXACT);
+    arb_neg(sm2, sm2);
+
+    wpt = 2 * prec + 64 + arf_abs_bound_lt_2exp_si(arb_midref(tm))
+        + FLINT_MAX(0, arf_abs_bound_lt_2exp_si(arb_midref(hm)))
+        + FLINT_BIT_COUNT(num);
+
+    /* asymptotic parts of R(s) and R(1 - conj(s)) at every point */
+    N_lo = UWORD_MAX;
+    wp = prec;
+    ok = 1;
+
+    for (k = 0; k < num && ok; k++)
+    {
+        arb_set(acb_realref(s), sm);
+        arb_mul_si(acb_imagref(s), hm, k, wpt);
+        arb_add(acb_imagref(s), acb_imagref(s), tm, wpt);
+
+        wp1 = _acb_dirichlet_zeta_rs_r_asymp(R1 + k, N, s, K, prec);
+        ok = (wp1 != 0);
+        Nk[k] = ok ? fmpz_get_ui(N) : 0;
+        wp = FLINT_MAX(wp, wp1);
+
+        if (ok && !half)
+        {
+            arb_set(acb_realref(s), sm2);
+            wp1 = _acb_dirichlet_zeta_rs_r_asymp(R2 + k, N, s, K, prec);
+            ok = (wp1 != 0);
+            wp = FLINT_MAX(wp, wp1);
+        }
+
+        N_lo = FLINT_MIN(N_lo, Nk[k]);
+    }
+
+    if (!ok)
+    {
+        _acb_dirichlet_zeta_rs_grid_naive(res, sigma, t0, h, num, K, prec);
+        goto cleanup;
+    }
+
+    /* the main sums up to the smallest N are shared by all points */
+    acb_dirichlet_powsum_grid(S1, sm, tm, hm, N_lo, num, wp);
+    if (!half)
+        acb_dirichlet_powsum_grid(S2, sm2, tm, hm, N_lo, num, wp);
+
+    for (k = 0; k < num; k++)
+    {
+        arb_set(acb_realref(s), sm);
+        arb_mul_si(acb_imagref(s), hm, k, wpt);
+        arb_add(acb_imagref(s), acb_imagref(s), tm, wpt);
+
+        _acb_dirichlet_powsum_range(u, s, N_lo, Nk[k], wp);
+        acb_add(R1 + k, R1 + k, u, wp);
+        acb_add(R1 + k, R1 + k, S1 + k, wp);
+
+        if (half)
+        {
+            acb_conj(R2 + k, R1 + k);
+        }
+        else
+        {
+            arb_set(acb_realref(s), sm2);
+            _acb_dirichlet_powsum_range(u, s, N_lo, Nk[k], wp);
+            acb_add(R2 + k, R2 + k, u, wp);
+            acb_add(R2 + k, R2 + k, S2 + k, wp);
+            acb_conj(R2 + k, R2 + k);
+            arb_set(acb_realref(s), sm);
+        }
+
+        if (acb_is_finite(R1 + k) && acb_is_finite(R2 + k))
+        {
+            wp1 = prec + 10 + arf_abs_bound_lt_2exp_si(arb_midref(acb_imagref(s)));
+            wp1 = FLINT_MAX(wp1, 10);
+
+            _acb_dirichlet_zeta_rs_x(X, s, wp1);
+            acb_mul(R2 + k, R2 + k, X, wp1);
+        }
+
+        acb_add(res + k, R1 + k, R2 + k, prec);
+
+        /* error <= |zeta'(s)| * rad(s) */
+        if (!arb_is_exact(sigma) || !arb_is_exact(t0) || !arb_is_exact(h))
+        {
+            arb_set(acb_realref(s), sigma);
+            arb_mul_si(acb_imagref(s), h, k, wpt);
+            arb_add(acb_imagref(s), acb_imagref(s), t0, wpt);
+
+            mag_hypot(rad, arb_radref(acb_realref(s)),
+                arb_radref(acb_imagref(s)));
+            acb_dirichlet_zeta_deriv_bound(err, err2, s);
+            mag_mul(err, err, rad);
+            acb_add_error_mag(res + k, err);
+        }
+    }
+
+cleanup:
+    _acb_vec_clear(R1, num);
+    _acb_vec_clear(R2, num);
+    _acb_vec_clear(S1, num);
+    _acb_vec_clear(S2, num);
+    flint_free(Nk);
+
+    arb_clear(sm);
+    arb_clear(sm2);
+    arb_clear(tm);
+    arb_clear(hm);
+    acb_clear(s);
+    acb_clear(u);
+    acb_clear(X);
+    fmpz_clear(N);
+    mag_clear(rad);
+    mag_clear(err);
+    mag_clear(err2);
+}
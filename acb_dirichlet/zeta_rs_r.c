@@ -11,14 +11,14 @@
 
 #include "acb_dirichlet.h"
 
-void
-acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
+slong
+_acb_dirichlet_zeta_rs_r_asymp(acb_t res, fmpz_t N,
+    const acb_t s, slong K, slong prec)
 {
     arb_ptr dk, pipow;
     acb_ptr Fp;
     arb_t a, p, api2, api2pow;
     acb_t U, S, u, v;
-    fmpz_t N;
     mag_t err;
     slong j, k, wp, K_limit;
 
@@ -34,7 +34,7 @@ acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
         if (!(sigma > -1e6 && sigma < 1e6) || !(t > 1 && t < 1e40))
         {
             acb_indeterminate(res);
-            return;
+            return 0;
         }
 
         best_K = 1;
@@ -77,7 +77,7 @@ acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
     {
         acb_indeterminate(res);
         mag_clear(err);
-        return;
+        return 0;
     }
 
     arb_init(a);
@@ -90,8 +90,6 @@ acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
     acb_init(u);
     acb_init(v);
 
-    fmpz_init(N);
-
     dk = _arb_vec_init((3 * K) / 2 + 2);
     Fp = _acb_vec_init(3 * K + 1);
     pipow = _arb_vec_init((3 * K) / 2 + 2);
@@ -112,6 +110,7 @@ acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
             if (wp > 4 * prec && wp > arb_rel_accuracy_bits(acb_imagref(s)))
             {
                 acb_indeterminate(res);
+                wp = 0;
                 goto cleanup;
             }
 
@@ -136,6 +135,7 @@ acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
     if (!fmpz_fits_si(N))
     {
         acb_indeterminate(res);
+        wp = 0;
         goto cleanup;
     }
 
@@ -202,13 +202,6 @@ acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
     if (fmpz_is_even(N))
         acb_neg(S, S);
 
-    if (_acb_vec_estimate_allocated_bytes(fmpz_get_ui(N) / 6, wp) < 4e9)
-        acb_dirichlet_powsum_sieved(u, s, fmpz_get_ui(N), 1, wp);
-    else
-        acb_dirichlet_powsum_smooth(u, s, fmpz_get_ui(N), 1, wp);
-
-    acb_add(S, S, u, wp);
-
     acb_set(res, S);  /* don't set_round here; the extra precision is useful */
 
 cleanup:
@@ -226,7 +219,34 @@ cleanup:
     acb_clear(u);
     acb_clear(v);
 
-    fmpz_clear(N);
     mag_clear(err);
+
+    return wp;
+}
+
+void
+acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
+{
+    acb_t u;
+    fmpz_t N;
+    slong wp;
+
+    acb_init(u);
+    fmpz_init(N);
+
+    wp = _acb_dirichlet_zeta_rs_r_asymp(res, N, s, K, prec);
+
+    if (wp != 0)
+    {
+        if (_acb_vec_estimate_allocated_bytes(fmpz_get_ui(N) / 6, wp) < 4e9)
+            acb_dirichlet_powsum_sieved_threaded(u, s, fmpz_get_ui(N), 1, wp);
+        else
+            acb_dirichlet_powsum_smooth(u, s, fmpz_get_ui(N), 1, wp);
+
+        acb_add(res, res, u, wp);
+    }
+
+    acb_clear(u);
+    fmpz_clear(N);
 }
 
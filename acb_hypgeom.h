@@ -90,6 +90,35 @@ void acb_hypgeom_pfq_series_direct(acb_poly_t res,
 void acb_hypgeom_pfq(acb_t res, acb_srcptr a, slong p, acb_srcptr b, slong q,
     const acb_t z, int regularized, slong prec);
 
+typedef struct
+{
+    acb_ptr a;
+    acb_ptr b;
+    slong p;
+    slong q;
+    int regularized;
+    int algorithm;
+    acb_ptr da;
+    acb_ptr db;
+    slong dp;
+    slong dq;
+    acb_struct c;
+    acb_ptr fac;
+    int fac_limit;
+    slong prec;
+}
+acb_hypgeom_pfq_precomp_struct;
+
+typedef acb_hypgeom_pfq_precomp_struct acb_hypgeom_pfq_precomp_t[1];
+
+void acb_hypgeom_pfq_precomp_init(acb_hypgeom_pfq_precomp_t pre, acb_srcptr a, slong p,
+    acb_srcptr b, slong q, int regularized, slong prec);
+void acb_hypgeom_pfq_precomp_clear(acb_hypgeom_pfq_precomp_t pre);
+void acb_hypgeom_pfq_precomp_eval(acb_t res, const acb_hypgeom_pfq_precomp_t pre,
+    const acb_t z, slong prec);
+void acb_hypgeom_pfq_precomp_eval_vec(acb_ptr res, const acb_hypgeom_pfq_precomp_t pre,
+    acb_srcptr z, slong len, slong prec);
+
 void acb_hypgeom_u_asymp(acb_t res, const acb_t a, const acb_t b,
     const acb_t z, slong n, slong prec);
 
@@ -125,6 +154,13 @@ void acb_hypgeom_bessel_k_scaled(acb_t res, const acb_t nu, const acb_t z, slong
 void acb_hypgeom_bessel_y(acb_t res, const acb_t nu, const acb_t z, slong prec);
 void acb_hypgeom_bessel_jy(acb_t res1, acb_t res2, const acb_t nu, const acb_t z, slong prec);
 
+void acb_hypgeom_bessel_j_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec);
+void acb_hypgeom_bessel_y_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec);
+void acb_hypgeom_bessel_i_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec);
+void acb_hypgeom_bessel_i_scaled_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec);
+void acb_hypgeom_bessel_k_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec);
+void acb_hypgeom_bessel_k_scaled_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec);
+
 void acb_hypgeom_0f1_asymp(acb_t res, const acb_t a, const acb_t z, int regularized, slong prec);
 void acb_hypgeom_0f1_direct(acb_t res, const acb_t a, const acb_t z, int regularized, slong prec);
 void acb_hypgeom_0f1(acb_t res, const acb_t a, const acb_t z, int regularized, slong prec);
@@ -228,6 +264,13 @@ void acb_hypgeom_2f1_transform(acb_t res, const acb_t a, const acb_t b,
 void acb_hypgeom_2f1_transform_limit(acb_t res, const acb_t a, const acb_t b,
     const acb_t c, const acb_t z, int regularized, int which, slong prec);
 
+void _acb_hypgeom_2f1_transform_nolimit_prefactors(acb_t tfac, acb_t ufac,
+    const acb_t a, const acb_t b, const acb_t c, int regularized, int which,
+    slong prec);
+void _acb_hypgeom_2f1_transform_nolimit_precomp(acb_t res, const acb_t a,
+    const acb_t b, const acb_t c, const acb_t z, const acb_t tfac,
+    const acb_t ufac, int which, slong prec);
+
 void acb_hypgeom_2f1_corner(acb_t res, const acb_t a, const acb_t b, const acb_t c, const acb_t z, int regularized, slong prec);
 
 int acb_hypgeom_2f1_choose(const acb_t z);
@@ -251,6 +294,13 @@ void acb_hypgeom_chebyshev_t(acb_t res, const acb_t n, const acb_t z, slong prec
 void acb_hypgeom_chebyshev_u(acb_t res, const acb_t n, const acb_t z, slong prec);
 void acb_hypgeom_spherical_y(acb_t res, slong n, slong m, const acb_t theta, const acb_t phi, slong prec);
 
+void acb_hypgeom_legendre_p_vec(acb_ptr res, acb_ptr res_prime, acb_srcptr z, slong num, slong len, slong prec);
+void acb_hypgeom_chebyshev_t_vec(acb_ptr res, acb_ptr res_prime, acb_srcptr z, slong num, slong len, slong prec);
+void acb_hypgeom_hermite_h_vec(acb_ptr res, acb_ptr res_prime, acb_srcptr z, slong num, slong len, slong prec);
+void acb_hypgeom_laguerre_l_vec(acb_ptr res, acb_ptr res_prime, const acb_t m, acb_srcptr z, slong num, slong len, slong prec);
+void acb_hypgeom_gegenbauer_c_vec(acb_ptr res, acb_ptr res_prime, const acb_t m, acb_srcptr z, slong num, slong len, slong prec);
+void acb_hypgeom_jacobi_p_vec(acb_ptr res, acb_ptr res_prime, const acb_t a, const acb_t b, acb_srcptr z, slong num, slong len, slong prec);
+
 void acb_hypgeom_dilog_bernoulli(acb_t res, const acb_t z, slong prec);
 void acb_hypgeom_dilog_continuation(acb_t res, const acb_t a, const acb_t z, slong prec);
 void acb_hypgeom_dilog_bitburst(acb_t res, acb_t z0, const acb_t z, slong prec);
@@ -224,9 +224,74 @@ acb_hypgeom_2f1_transform_limit(acb_t res, const acb_t a, const acb_t b,
     acb_clear(t);
 }
 
+/*
+    Sets tfac and ufac to the parameter-only factors of the left and right
+    terms of the transformation formula for which = 2, 3 (the same
+    factors) or which = 4, 5, including pi/sin(pi (b-a)) or
+    pi/sin(pi (c-a-b)) and, if not regularized, gamma(c).
+*/
 void
-acb_hypgeom_2f1_transform_nolimit(acb_t res, const acb_t a, const acb_t b,
-    const acb_t c, const acb_t z, int regularized, int which, slong prec)
+_acb_hypgeom_2f1_transform_nolimit_prefactors(acb_t tfac, acb_t ufac,
+    const acb_t a, const acb_t b, const acb_t c, int regularized, int which,
+    slong prec)
+{
+    acb_t v, d;
+
+    acb_init(v);
+    acb_init(d);
+
+    acb_rgamma(ufac, a, prec);
+    acb_sub(d, c, a, prec);
+    acb_rgamma(tfac, d, prec);
+
+    acb_rgamma(v, b, prec);
+    if (which == 2 || which == 3)
+        acb_mul(tfac, tfac, v, prec);
+    else
+        acb_mul(ufac, ufac, v, prec);
+
+    acb_sub(d, c, b, prec);
+    acb_rgamma(v, d, prec);
+    if (which == 2 || which == 3)
+        acb_mul(ufac, ufac, v, prec);
+    else
+        acb_mul(tfac, tfac, v, prec);
+
+    if (which == 2 || which == 3)
+    {
+        acb_sub(d, b, a, prec);
+    }
+    else
+    {
+        acb_sub(d, c, a, prec);
+        acb_sub(d, d, b, prec);
+    }
+
+    acb_sin_pi(v, d, prec);
+    acb_const_pi(d, prec);
+    acb_div(v, d, v, prec);
+
+    if (!regularized)
+    {
+        acb_gamma(d, c, prec);
+        acb_mul(v, v, d, prec);
+    }
+
+    acb_mul(tfac, tfac, v, prec);
+    acb_mul(ufac, ufac, v, prec);
+
+    acb_clear(v);
+    acb_clear(d);
+}
+
+/*
+    Evaluates the transformation formula given the factors computed by
+    _acb_hypgeom_2f1_transform_nolimit_prefactors.
+*/
+void
+_acb_hypgeom_2f1_transform_nolimit_precomp(acb_t res, const acb_t a,
+    const acb_t b, const acb_t c, const acb_t z, const acb_t tfac,
+    const acb_t ufac, int which, slong prec)
 {
     acb_t ba, ca, cb, cab, ac1, bc1, ab1, ba1, w, t, u, v, s;
 
@@ -242,16 +307,6 @@ acb_hypgeom_2f1_transform_nolimit(acb_t res, const acb_t a, const acb_t b,
         return;
     }
 
-    if (!regularized)
-    {
-        acb_init(t);
-        acb_gamma(t, c, prec);
-        acb_hypgeom_2f1_transform_nolimit(res, a, b, c, z, 1, which, prec);
-        acb_mul(res, res, t, prec);
-        acb_clear(t);
-        return;
-    }
-
     acb_init(ba);
     acb_init(ca); acb_init(cb); acb_init(cab);
     acb_init(ac1); acb_init(bc1);
@@ -312,23 +367,9 @@ acb_hypgeom_2f1_transform_nolimit(acb_t res, const acb_t a, const acb_t b,
         flint_abort();
     }
 
-    /* gamma factors */
-    acb_rgamma(v, a, prec);
-    acb_mul(u, u, v, prec);
-    acb_rgamma(v, ca, prec);
-    acb_mul(t, t, v, prec);
-
-    acb_rgamma(v, b, prec);
-    if (which == 2 || which == 3)
-        acb_mul(t, t, v, prec);
-    else
-        acb_mul(u, u, v, prec);
-
-    acb_rgamma(v, cb, prec);
-    if (which == 2 || which == 3)
-        acb_mul(u, u, v, prec);
-    else
-        acb_mul(t, t, v, prec);
+    /* parameter-only factors */
+    acb_mul(t, t, tfac, prec);
+    acb_mul(u, u, ufac, prec);
 
     if (which == 2 || which == 3)
     {
@@ -360,17 +401,7 @@ acb_hypgeom_2f1_transform_nolimit(acb_t res, const acb_t a, const acb_t b,
         }
     }
 
-    acb_sub(t, t, u, prec);
-
-    if (which == 2 || which == 3)
-        acb_sin_pi(v, ba, prec);
-    else
-        acb_sin_pi(v, cab, prec);
-
-    acb_div(t, t, v, prec);
-    acb_const_pi(v, prec);
-    acb_mul(t, t, v, prec);
-    acb_set(res, t);
+    acb_sub(res, t, u, prec);
 
     acb_clear(ba);
     acb_clear(ca); acb_clear(cb); acb_clear(cab);
@@ -381,6 +412,42 @@ acb_hypgeom_2f1_transform_nolimit(acb_t res, const acb_t a, const acb_t b,
     acb_clear(s);
 }
 
+void
+acb_hypgeom_2f1_transform_nolimit(acb_t res, const acb_t a, const acb_t b,
+    const acb_t c, const acb_t z, int regularized, int which, slong prec)
+{
+    acb_t tfac, ufac;
+
+    if (acb_contains_zero(z) || !acb_is_finite(z))
+    {
+        acb_indeterminate(res);
+        return;
+    }
+
+    if (arb_contains_si(acb_realref(z), 1) && arb_contains_zero(acb_imagref(z)))
+    {
+        acb_indeterminate(res);
+        return;
+    }
+
+    if (which < 2 || which > 5)
+    {
+        flint_printf("invalid transformation!\n");
+        flint_abort();
+    }
+
+    acb_init(tfac);
+    acb_init(ufac);
+
+    _acb_hypgeom_2f1_transform_nolimit_prefactors(tfac, ufac, a, b, c,
+        regularized, which, prec);
+    _acb_hypgeom_2f1_transform_nolimit_precomp(res, a, b, c, z, tfac, ufac,
+        which, prec);
+
+    acb_clear(tfac);
+    acb_clear(ufac);
+}
+
 void
 acb_hypgeom_2f1_transform(acb_t res, const acb_t a, const acb_t b,
     const acb_t c, const acb_t z, int flags, int which, slong prec)
@@ -0,0 +1,223 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+typedef void (*bessel_func_t)(acb_t, const acb_t, const acb_t, slong);
+
+#define BESSEL_VEC_BLOCK 64
+
+/* number of k with 0 <= k < len and |nu + k| < r */
+static slong
+_bessel_vec_num_oscillatory(double nu, double r, slong len)
+{
+    double lo, hi;
+
+    if (!(r > 0.0) || nu != nu)
+        return 0;
+
+    r = FLINT_MIN(r, 1e15);
+    nu = FLINT_MAX(FLINT_MIN(nu, 1e15), -1e15);
+
+    lo = FLINT_MAX(ceil(-r - nu), 0.0);
+    hi = FLINT_MIN(floor(r - nu), (double) (len - 1));
+
+    if (hi < lo)
+        return 0;
+
+    return (slong) (hi - lo) + 1;
+}
+
+/*
+    Sets res[k] = C_{nu+k}(z) for lo <= k < hi, starting from two anchor
+    values computed with func and applying the three-term recurrence
+    forward from lo or backward from hi - 1.
+*/
+static void
+_acb_hypgeom_bessel_vec_block(acb_ptr res, const acb_t n, const acb_t x,
+    const acb_t w, slong lo, slong hi, bessel_func_t func, int sign,
+    int backward, slong wp)
+{
+    acb_t t;
+    slong k;
+
+    acb_init(t);
+
+    if (hi - lo <= 2)
+    {
+        for (k = lo; k < hi; k++)
+        {
+            acb_add_si(t, n, k, wp);
+            func(res + k, t, x, wp);
+        }
+    }
+    else if (backward)
+    {
+        acb_add_si(t, n, hi - 1, wp);
+        func(res + hi - 1, t, x, wp);
+        acb_add_si(t, n, hi - 2, wp);
+        func(res + hi - 2, t, x, wp);
+
+        for (k = hi - 2; k > lo; k--)
+        {
+            acb_add_si(t, n, k, wp);
+            acb_mul(t, t, w, wp);
+            acb_mul(t, t, res + k, wp);
+
+            if (sign == 1)
+                acb_sub(res + k - 1, t, res + k + 1, wp);
+            else
+                acb_add(res + k - 1, t, res + k + 1, wp);
+        }
+    }
+    else
+    {
+        acb_add_si(t, n, lo, wp);
+        func(res + lo, t, x, wp);
+        acb_add_si(t, n, lo + 1, wp);
+        func(res + lo + 1, t, x, wp);
+
+        for (k = lo + 1; k < hi - 1; k++)
+        {
+            acb_add_si(t, n, k, wp);
+            acb_mul(t, t, w, wp);
+            acb_mul(t, t, res + k, wp);
+
+            if (sign == 1)
+                acb_sub(res + k + 1, t, res + k - 1, wp);
+            else
+                acb_add(res + k + 1, t, res + k - 1, wp);
+        }
+    }
+
+    acb_clear(t);
+}
+
+/*
+    Sets res[k] = C_{nu+k}(z) for 0 <= k < len, where C is one of the
+    Bessel functions. With sign = 1, J and Y satisfy
+
+        C_{m-1} + C_{m+1} = (2m/z) C_m,
+
+    and with sign = -1, I and K (as well as the scaled versions) satisfy
+
+        I_{m-1} - I_{m+1} = (2m/z) I_m,   K_{m+1} - K_{m-1} = (2m/z) K_m.
+
+    Two anchor values are computed with func and the remaining values
+    are obtained by recurrence, running forward (stable for the
+    dominant solutions Y and K) or backward (stable for the minimal
+    solutions J and I). The recurrence is done in ball arithmetic, so
+    the output is always rigorous.
+
+    In the oscillatory region (|m| < |z| for J and Y, and |m| < |Im(z)|
+    for I and K), the solutions do not grow, but the radii can grow by a factor up to 1 + sqrt(2) (about
+    1.27 bits) per step. The recurrence is therefore restarted from new
+    anchor values every BESSEL_VEC_BLOCK orders, and the working
+    precision includes enough guard bits for the loss within one block.
+*/
+static void
+_acb_hypgeom_bessel_vec(acb_ptr res, const acb_t nu, const acb_t z,
+    slong len, bessel_func_t func, int sign, int backward, slong prec)
+{
+    acb_t n, x, w;
+    mag_t r;
+    slong k, wp, osc, block;
+
+    if (len <= 0)
+        return;
+
+    acb_init(n);
+    acb_init(x);
+    acb_init(w);
+    mag_init(r);
+
+    acb_set(n, nu);
+    acb_set(x, z);
+
+    if (len <= 2 || !acb_is_finite(x) || acb_contains_zero(x))
+    {
+        for (k = 0; k < len; k++)
+        {
+            acb_add_si(w, n, k, prec);
+            func(res + k, w, x, prec);
+        }
+    }
+    else
+    {
+        /* J and Y oscillate for |m| < |z| near the real axis, and I and K
+           for |m| < |Im(z)| near the imaginary axis */
+        if (sign == 1)
+            acb_get_mag(r, x);
+        else
+            arb_get_mag(r, acb_imagref(x));
+
+        osc = _bessel_vec_num_oscillatory(
+            arf_get_d(arb_midref(acb_realref(n)), ARF_RND_NEAR),
+            mag_get_d(r), len);
+
+        block = (osc > 0) ? BESSEL_VEC_BLOCK : len;
+
+        wp = prec + 2 * FLINT_BIT_COUNT(len) + 10;
+        wp += (slong) (1.28 * FLINT_MIN(osc, block)) + 1;
+
+        acb_inv(w, x, wp);
+        acb_mul_2exp_si(w, w, 1);
+
+        for (k = 0; k < len; k += block)
+            _acb_hypgeom_bessel_vec_block(res, n, x, w, k,
+                FLINT_MIN(k + block, len), func, sign, backward, wp);
+
+        for (k = 0; k < len; k++)
+            acb_set_round(res + k, res + k, prec);
+    }
+
+    acb_clear(n);
+    acb_clear(x);
+    acb_clear(w);
+    mag_clear(r);
+}
+
+void
+acb_hypgeom_bessel_j_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec)
+{
+    _acb_hypgeom_bessel_vec(res, nu, z, len, acb_hypgeom_bessel_j, 1, 1, prec);
+}
+
+void
+acb_hypgeom_bessel_y_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec)
+{
+    _acb_hypgeom_bessel_vec(res, nu, z, len, acb_hypgeom_bessel_y, 1, 0, prec);
+}
+
+void
+acb_hypgeom_bessel_i_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec)
+{
+    _acb_hypgeom_bessel_vec(res, nu, z, len, acb_hypgeom_bessel_i, -1, 1, prec);
+}
+
+void
+acb_hypgeom_bessel_i_scaled_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec)
+{
+    _acb_hypgeom_bessel_vec(res, nu, z, len, acb_hypgeom_bessel_i_scaled, -1, 1, prec);
+}
+
+void
+acb_hypgeom_bessel_k_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec)
+{
+    _acb_hypgeom_bessel_vec(res, nu, z, len, acb_hypgeom_bessel_k, -1, 0, prec);
+}
+
+void
+acb_hypgeom_bessel_k_scaled_vec(acb_ptr res, const acb_t nu, const acb_t z, slong len, slong prec)
+{
+    _acb_hypgeom_bessel_vec(res, nu, z, len, acb_hypgeom_bessel_k_scaled, -1, 0, prec);
+}
+
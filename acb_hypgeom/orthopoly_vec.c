@@ -0,0 +1,411 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "acb_hypgeom.h"
+
+#define ORTHO_LEGENDRE_P 0
+#define ORTHO_CHEBYSHEV_T 1
+#define ORTHO_HERMITE_H 2
+#define ORTHO_LAGUERRE_L 3
+#define ORTHO_GEGENBAUER_C 4
+#define ORTHO_JACOBI_P 5
+
+/*
+    All families satisfy y_0 = 1, y_1 = c1 z + c0 and, for n >= 2,
+
+        delta y_n = (alpha z + beta) y_{n-1} - gamma y_{n-2}
+
+    where the coefficients depend on n and the parameters (a, b).
+*/
+static void
+_ortho_initial(acb_t c1, acb_t c0, int kind,
+    const acb_t a, const acb_t b, slong prec)
+{
+    switch (kind)
+    {
+        case ORTHO_LEGENDRE_P:
+        case ORTHO_CHEBYSHEV_T:
+            acb_one(c1);
+            acb_zero(c0);
+            break;
+        case ORTHO_HERMITE_H:
+            acb_set_ui(c1, 2);
+            acb_zero(c0);
+            break;
+        case ORTHO_LAGUERRE_L:
+            acb_set_si(c1, -1);
+            acb_add_ui(c0, a, 1, prec);
+            break;
+        case ORTHO_GEGENBAUER_C:
+            acb_mul_2exp_si(c1, a, 1);
+            acb_zero(c0);
+            break;
+        default:
+            /* (a+b+2)/2 z + (a-b)/2 */
+            acb_add(c1, a, b, prec);
+            acb_add_ui(c1, c1, 2, prec);
+            acb_mul_2exp_si(c1, c1, -1);
+            acb_sub(c0, a, b, prec);
+            acb_mul_2exp_si(c0, c0, -1);
+    }
+}
+
+static void
+_ortho_coeffs(acb_t alpha, acb_t beta, acb_t gamma, acb_t delta,
+    int kind, ulong n, const acb_t a, const acb_t b, slong prec)
+{
+    acb_t s, t;
+
+    switch (kind)
+    {
+        case ORTHO_LEGENDRE_P:
+            acb_set_ui(alpha, 2 * n - 1);
+            acb_zero(beta);
+            acb_set_ui(gamma, n - 1);
+            acb_set_ui(delta, n);
+            break;
+        case ORTHO_CHEBYSHEV_T:
+            acb_set_ui(alpha, 2);
+            acb_zero(beta);
+            acb_one(gamma);
+            acb_one(delta);
+            break;
+        case ORTHO_HERMITE_H:
+            acb_set_ui(alpha, 2);
+            acb_zero(beta);
+            acb_set_ui(gamma, 2 * n - 2);
+            acb_one(delta);
+            break;
+        case ORTHO_LAGUERRE_L:
+            acb_set_si(alpha, -1);
+            acb_add_ui(beta, a, 2 * n - 1, prec);
+            acb_add_ui(gamma, a, n - 1, prec);
+            acb_set_ui(delta, n);
+            break;
+        case ORTHO_GEGENBAUER_C:
+            acb_add_ui(alpha, a, n - 1, prec);
+            acb_mul_2exp_si(alpha, alpha, 1);
+            acb_zero(beta);
+            acb_mul_2exp_si(gamma, a, 1);
+            acb_add_ui(gamma, gamma, n - 2, prec);
+            acb_set_ui(delta, n);
+            break;
+        default:
+            acb_init(s);
+            acb_init(t);
+
+            /* s = 2n + a + b */
+            acb_add(s, a, b, prec);
+            acb_add_ui(s, s, 2 * n, prec);
+
+            /* delta = 2n (n + a + b) (s - 2) */
+            acb_add(delta, a, b, prec);
+            acb_add_ui(delta, delta, n, prec);
+            acb_sub_ui(t, s, 2, prec);
+            acb_mul(delta, delta, t, prec);
+            acb_mul_ui(delta, delta, 2 * n, prec);
+
+            /* alpha = (s - 1) s (s - 2) */
+            acb_mul(alpha, s, t, prec);
+            acb_sub_ui(t, s, 1, prec);
+            acb_mul(alpha, alpha, t, prec);
+
+            /* beta = (s - 1) (a^2 - b^2) = (s - 1) (a + b) (a - b) */
+            acb_add(beta, a, b, prec);
+            acb_mul(beta, beta, t, prec);
+            acb_sub(t, a, b, prec);
+            acb_mul(beta, beta, t, prec);
+
+            /* gamma = 2 (n + a - 1) (n + b - 1) s */
+            acb_add_si(gamma, a, (slong) n - 1, prec);
+            acb_add_si(t, b, (slong) n - 1, prec);
+            acb_mul(gamma, gamma, t, prec);
+            acb_mul(gamma, gamma, s, prec);
+            acb_mul_2exp_si(gamma, gamma, 1);
+
+            acb_clear(s);
+            acb_clear(t);
+    }
+}
+
+/*
+    Sets y[k * len + n] to the k-th derivative of y_n at z, for
+    0 <= k < order and 0 <= n < len, by differentiating the
+    recurrence: the k-th derivative picks up the extra term
+    k alpha y_{n-1}^{(k-1)}.
+*/
+static void
+_ortho_jet(acb_ptr y, int kind, const acb_t a, const acb_t b,
+    const acb_t z, slong len, slong order, slong prec)
+{
+    acb_t alpha, beta, gamma, delta, t, u;
+    slong n, k;
+
+    _acb_vec_zero(y, order * len);
+
+    if (len < 1 || order < 1)
+        return;
+
+    acb_one(y);
+
+    if (len == 1)
+        return;
+
+    acb_init(alpha);
+    acb_init(beta);
+    acb_init(gamma);
+    acb_init(delta);
+    acb_init(t);
+    acb_init(u);
+
+    _ortho_initial(alpha, beta, kind, a, b, prec);
+    acb_mul(y + 1, alpha, z, prec);
+    acb_add(y + 1, y + 1, beta, prec);
+    if (order > 1)
+        acb_set(y + len + 1, alpha);
+
+    for (n = 2; n < len; n++)
+    {
+        _ortho_coeffs(alpha, beta, gamma, delta, kind, n, a, b, prec);
+
+        acb_mul(t, alpha, z, prec);
+        acb_add(t, t, beta, prec);
+
+        /* beta is used as scratch space below */
+        for (k = order - 1; k >= 0; k--)
+        {
+            acb_mul(u, t, y + k * len + n - 1, prec);
+            acb_submul(u, gamma, y + k * len + n - 2, prec);
+            if (k > 0)
+            {
+                acb_mul(beta, alpha, y + (k - 1) * len + n - 1, prec);
+                acb_addmul_ui(u, beta, k, prec);
+            }
+            if (acb_is_one(delta))
+                acb_swap(y + k * len + n, u);
+            else
+                acb_div(y + k * len + n, u, delta, prec);
+        }
+    }
+
+    acb_clear(alpha);
+    acb_clear(beta);
+    acb_clear(gamma);
+    acb_clear(delta);
+    acb_clear(t);
+    acb_clear(u);
+}
+
+/*
+    The recurrence is run on the midpoint of z, where the only source
+    of error is rounding. Since ball arithmetic overestimates the
+    propagated rounding errors in a three-term recurrence, the working
+    precision is increased until the entries have about prec accurate
+    bits (relative to the larger of two consecutive entries). The
+    radius of z is then accounted for by bounding the next derivative
+    on the whole ball.
+*/
+static void
+_ortho_vec_point(acb_ptr res, acb_ptr res_prime, int kind,
+    const acb_t a, const acb_t b, const acb_t z, slong len, slong prec)
+{
+    acb_ptr y, w;
+    acb_t m;
+    mag_t r, e;
+    slong n, k, order, wp, deficit, attempt;
+
+    if (len <= 0)
+        return;
+
+    order = (res_prime != NULL) ? 2 : 1;
+
+    y = _acb_vec_init(order * len);
+    acb_init(m);
+    mag_init(r);
+    mag_init(e);
+
+    acb_get_mid(m, z);
+    mag_hypot(r, arb_radref(acb_realref(z)), arb_radref(acb_imagref(z)));
+
+    wp = prec + 2 * FLINT_BIT_COUNT(len) + 10;
+
+    for (attempt = 0; ; attempt++)
+    {
+        _ortho_jet(y, kind, a, b, m, len, order, wp);
+
+        deficit = 0;
+        for (n = 1; n < len; n++)
+            deficit = FLINT_MAX(deficit, prec + FLINT_MIN(
+                acb_rel_error_bits(y + n), acb_rel_error_bits(y + n - 1)));
+
+        if (deficit <= 0 || attempt >= 2 || deficit > 8 * wp)
+            break;
+
+        wp += deficit + 10;
+    }
+
+    if (!mag_is_zero(r))
+    {
+        w = _acb_vec_init((order + 1) * len);
+        _ortho_jet(w, kind, a, b, z, len, order + 1, wp);
+
+        for (k = 0; k < order; k++)
+        {
+            for (n = 0; n < len; n++)
+            {
+                acb_get_mag(e, w + (k + 1) * len + n);
+                mag_mul(e, e, r);
+                acb_add_error_mag(y + k * len + n, e);
+            }
+        }
+
+        _acb_vec_clear(w, (order + 1) * len);
+    }
+
+    for (n = 0; n < len; n++)
+        acb_set_round(res + n, y + n, prec);
+
+    if (res_prime != NULL)
+        for (n = 0; n < len; n++)
+            acb_set_round(res_prime + n, y + len + n, prec);
+
+    _acb_vec_clear(y, order * len);
+    acb_clear(m);
+    mag_clear(r);
+    mag_clear(e);
+}
+
+typedef struct
+{
+    acb_ptr res;
+    acb_ptr res_prime;
+    int kind;
+    acb_srcptr a;
+    acb_srcptr b;
+    acb_srcptr z;
+    slong start;
+    slong step;
+    slong num;
+    slong len;
+    slong prec;
+}
+ortho_vec_arg_t;
+
+static void *
+_ortho_vec_worker(void * arg_ptr)
+{
+    ortho_vec_arg_t arg = *((ortho_vec_arg_t *) arg_ptr);
+    slong i;
+
+    for (i = arg.start; i < arg.num; i += arg.step)
+        _ortho_vec_point(arg.res + i * arg.len,
+            (arg.res_prime == NULL) ? NULL : arg.res_prime + i * arg.len,
+            arg.kind, arg.a, arg.b, arg.z + i, arg.len, arg.prec);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
+static void
+_ortho_vec(acb_ptr res, acb_ptr res_prime, int kind,
+    const acb_t a, const acb_t b, acb_srcptr z, slong num, slong len, slong prec)
+{
+    pthread_t * threads;
+    ortho_vec_arg_t * args;
+    slong i, num_threads;
+
+    if (num <= 0 || len <= 0)
+        return;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num);
+
+    if (num_threads <= 1 || num * len < 256)
+    {
+        for (i = 0; i < num; i++)
+            _ortho_vec_point(res + i * len,
+                (res_prime == NULL) ? NULL : res_prime + i * len,
+                kind, a, b, z + i, len, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(ortho_vec_arg_t) * num_threads);
+
+    /* the working precision is chosen per point, so the points
+       are distributed cyclically rather than in contiguous blocks */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = res;
+        args[i].res_prime = res_prime;
+        args[i].kind = kind;
+        args[i].a = a;
+        args[i].b = b;
+        args[i].z = z;
+        args[i].start = i;
+        args[i].step = num_threads;
+        args[i].num = num;
+        args[i].len = len;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, _ortho_vec_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void
+acb_hypgeom_legendre_p_vec(acb_ptr res, acb_ptr res_prime,
+    acb_srcptr z, slong num, slong len, slong prec)
+{
+    _ortho_vec(res, res_prime, ORTHO_LEGENDRE_P, NULL, NULL, z, num, len, prec);
+}
+
+void
+acb_hypgeom_chebyshev_t_vec(acb_ptr res, acb_ptr res_prime,
+    acb_srcptr z, slong num, slong len, slong prec)
+{
+    _ortho_vec(res, res_prime, ORTHO_CHEBYSHEV_T, NULL, NULL, z, num, len, prec);
+}
+
+void
+acb_hypgeom_hermite_h_vec(acb_ptr res, acb_ptr res_prime,
+    acb_srcptr z, slong num, slong len, slong prec)
+{
+    _ortho_vec(res, res_prime, ORTHO_HERMITE_H, NULL, NULL, z, num, len, prec);
+}
+
+void
+acb_hypgeom_laguerre_l_vec(acb_ptr res, acb_ptr res_prime, const acb_t m,
+    acb_srcptr z, slong num, slong len, slong prec)
+{
+    _ortho_vec(res, res_prime, ORTHO_LAGUERRE_L, m, NULL, z, num, len, prec);
+}
+
+void
+acb_hypgeom_gegenbauer_c_vec(acb_ptr res, acb_ptr res_prime, const acb_t m,
+    acb_srcptr z, slong num, slong len, slong prec)
+{
+    _ortho_vec(res, res_prime, ORTHO_GEGENBAUER_C, m, NULL, z, num, len, prec);
+}
+
+void
+acb_hypgeom_jacobi_p_vec(acb_ptr res, acb_ptr res_prime, const acb_t a, const acb_t b,
+    acb_srcptr z, slong num, slong len, slong prec)
+{
+    _ortho_vec(res, res_prime, ORTHO_JACOBI_P, a, b, z, num, len, prec);
+}
+
@@ -0,0 +1,377 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+#define PFQ_EXP     0
+#define PFQ_POW     1
+#define PFQ_0F1     2
+#define PFQ_1F1     3
+#define PFQ_2F1     4
+#define PFQ_SERIES  5
+#define PFQ_DIRECT  6
+
+/* PFQ_DIRECT caches the reduced parameter lists and the 1/Gamma(b_i)
+   product; PFQ_2F1 caches the gamma and sine prefactors of the
+   transformations 2-5 (which do not depend on z). The other cases
+   dispatch to the same functions as acb_hypgeom_pfq for each point. */
+
+/* bits of fac_limit: b-a resp. c-a-b is an integer, so that the
+   transformations 2, 3 resp. 4, 5 need the limit computation */
+#define PFQ_LIMIT_23  1
+#define PFQ_LIMIT_45  2
+
+static int
+_acb_vec_maybe_nonpositive_int(acb_srcptr b, slong q)
+{
+    slong i;
+
+    for (i = 0; i < q; i++)
+        if (!arb_is_positive(acb_realref(b + i)) && acb_contains_int(b + i))
+            return 1;
+
+    return 0;
+}
+
+static int
+_acb_is_nonpositive_int(const acb_t x)
+{
+    return acb_is_int(x) && arb_is_nonpositive(acb_realref(x));
+}
+
+/* conservatively true if acb_hypgeom_2f1 may use one of its special
+   cases (zero, reduced, polynomial or Pfaff) for these parameters */
+static int
+_acb_hypgeom_2f1_special(const acb_t a, const acb_t b, const acb_t c,
+    int regularized, slong prec)
+{
+    acb_t t;
+    int res;
+
+    if (!acb_is_finite(a) || !acb_is_finite(b) || !acb_is_finite(c))
+        return 1;
+
+    if (regularized && (_acb_is_nonpositive_int(c) ||
+            acb_eq(a, c) || acb_eq(b, c)))
+        return 1;
+
+    if (_acb_is_nonpositive_int(a) || _acb_is_nonpositive_int(b))
+        return 1;
+
+    res = 0;
+
+    if (acb_is_exact(c))
+    {
+        acb_init(t);
+        acb_sub(t, c, b, prec);
+        res = _acb_is_nonpositive_int(t);
+        acb_sub(t, c, a, prec);
+        res = res || _acb_is_nonpositive_int(t);
+        acb_clear(t);
+    }
+
+    return res;
+}
+
+static void
+_acb_hypgeom_2f1_precomp_init(acb_hypgeom_pfq_precomp_t pre, slong prec)
+{
+    acb_srcptr a = pre->a;
+    acb_srcptr c = pre->b;
+    acb_t d;
+
+    if (_acb_hypgeom_2f1_special(a, a + 1, c, pre->regularized, prec))
+        return;
+
+    acb_init(d);
+    pre->fac = _acb_vec_init(4);
+
+    acb_sub(d, a + 1, a, prec);
+    if (acb_is_int(d))
+        pre->fac_limit |= PFQ_LIMIT_23;
+    else
+        _acb_hypgeom_2f1_transform_nolimit_prefactors(pre->fac,
+            pre->fac + 1, a, a + 1, c, pre->regularized, 2, prec);
+
+    acb_sub(d, c, a, prec);
+    acb_sub(d, d, a + 1, prec);
+    if (acb_is_int(d))
+        pre->fac_limit |= PFQ_LIMIT_45;
+    else
+        _acb_hypgeom_2f1_transform_nolimit_prefactors(pre->fac + 2,
+            pre->fac + 3, a, a + 1, c, pre->regularized, 4, prec);
+
+    acb_clear(d);
+}
+
+static void
+_acb_hypgeom_2f1_precomp_eval(acb_t res, const acb_hypgeom_pfq_precomp_t pre,
+    const acb_t z, slong prec)
+{
+    acb_srcptr a = pre->a;
+    acb_srcptr c = pre->b;
+    int algorithm, flags;
+
+    flags = pre->regularized ? ACB_HYPGEOM_2F1_REGULARIZED : 0;
+
+    /* the cached prefactors are only as precise as
+       the precision used to create pre */
+    if (pre->fac == NULL || prec > pre->prec || !acb_is_finite(z) ||
+        acb_is_zero(z) || acb_is_one(z))
+    {
+        acb_hypgeom_2f1(res, a, a + 1, c, z, flags, prec);
+        return;
+    }
+
+    algorithm = acb_hypgeom_2f1_choose(z);
+
+    if (algorithm == 0)
+    {
+        acb_hypgeom_2f1_direct(res, a, a + 1, c, z, pre->regularized, prec);
+    }
+    else if ((algorithm == 2 || algorithm == 3) &&
+        !(pre->fac_limit & PFQ_LIMIT_23))
+    {
+        _acb_hypgeom_2f1_transform_nolimit_precomp(res, a, a + 1, c, z,
+            pre->fac, pre->fac + 1, algorithm, prec);
+    }
+    else if ((algorithm == 4 || algorithm == 5) &&
+        !(pre->fac_limit & PFQ_LIMIT_45))
+    {
+        _acb_hypgeom_2f1_transform_nolimit_precomp(res, a, a + 1, c, z,
+            pre->fac + 2, pre->fac + 3, algorithm, prec);
+    }
+    else if (algorithm >= 1 && algorithm <= 5)
+    {
+        acb_hypgeom_2f1_transform(res, a, a + 1, c, z, flags, algorithm, prec);
+    }
+    else
+    {
+        acb_hypgeom_2f1_corner(res, a, a + 1, c, z, pre->regularized, prec);
+    }
+}
+
+static void
+_acb_hypgeom_rgamma_prod(acb_t c, acb_srcptr b, slong q, slong prec)
+{
+    acb_t t;
+    slong i;
+
+    acb_init(t);
+    acb_rgamma(c, b, prec);
+
+    for (i = 1; i < q; i++)
+    {
+        acb_rgamma(t, b + i, prec);
+        acb_mul(c, c, t, prec);
+    }
+
+    acb_clear(t);
+}
+
+void
+acb_hypgeom_pfq_precomp_init(acb_hypgeom_pfq_precomp_t pre, acb_srcptr a, slong p,
+    acb_srcptr b, slong q, int regularized, slong prec)
+{
+    slong i, j;
+
+    pre->p = p;
+    pre->q = q;
+    pre->a = _acb_vec_init(p);
+    pre->b = _acb_vec_init(q);
+    _acb_vec_set(pre->a, a, p);
+    _acb_vec_set(pre->b, b, q);
+    pre->regularized = regularized;
+    pre->da = NULL;
+    pre->db = NULL;
+    pre->dp = 0;
+    pre->dq = 0;
+    acb_init(&pre->c);
+    acb_one(&pre->c);
+    pre->fac = NULL;
+    pre->fac_limit = 0;
+    pre->prec = prec;
+
+    if (p == 0 && q == 0)
+        pre->algorithm = PFQ_EXP;
+    else if (p == 1 && q == 0)
+        pre->algorithm = PFQ_POW;
+    else if (p == 0 && q == 1)
+        pre->algorithm = PFQ_0F1;
+    else if (p == 1 && q == 1)
+        pre->algorithm = PFQ_1F1;
+    else if (p == 2 && q == 1)
+    {
+        pre->algorithm = PFQ_2F1;
+        _acb_hypgeom_2f1_precomp_init(pre, prec);
+    }
+    else if (regularized && _acb_vec_maybe_nonpositive_int(b, q))
+        pre->algorithm = PFQ_SERIES;
+    else
+    {
+        pre->algorithm = PFQ_DIRECT;
+
+        /* check if we can remove a '1' from the upper parameters */
+        for (i = 0; i < p; i++)
+        {
+            if (acb_is_one(a + i))
+            {
+                pre->dp = p - 1;
+                pre->da = _acb_vec_init(p - 1);
+                for (j = 0; j < p - 1; j++)
+                    acb_set(pre->da + j, a + j + (j >= i));
+
+                pre->dq = q;
+                pre->db = _acb_vec_init(q);
+                _acb_vec_set(pre->db, b, q);
+                break;
+            }
+        }
+
+        if (pre->da == NULL)
+        {
+            pre->dp = p;
+            pre->da = _acb_vec_init(p);
+            _acb_vec_set(pre->da, a, p);
+
+            pre->dq = q + 1;
+            pre->db = _acb_vec_init(q + 1);
+            _acb_vec_set(pre->db, b, q);
+            acb_one(pre->db + q);
+        }
+
+        if (regularized && q > 0)
+            _acb_hypgeom_rgamma_prod(&pre->c, b, q, prec);
+    }
+}
+
+void
+acb_hypgeom_pfq_precomp_clear(acb_hypgeom_pfq_precomp_t pre)
+{
+    _acb_vec_clear(pre->a, pre->p);
+    _acb_vec_clear(pre->b, pre->q);
+
+    if (pre->da != NULL)
+        _acb_vec_clear(pre->da, pre->dp);
+    if (pre->db != NULL)
+        _acb_vec_clear(pre->db, pre->dq);
+    if (pre->fac != NULL)
+        _acb_vec_clear(pre->fac, 4);
+
+    acb_clear(&pre->c);
+}
+
+static void
+_acb_hypgeom_pfq_series_eval(acb_t res, acb_srcptr a, slong p,
+    acb_srcptr b, slong q, const acb_t z, int regularized, slong prec)
+{
+    /* todo: implement regularized sum without using polynomials */
+    acb_poly_struct * tmp;
+    slong i;
+
+    tmp = flint_malloc(sizeof(acb_poly_struct) * (p + q + 2));
+    for (i = 0; i < p + q + 2; i++)
+        acb_poly_init(tmp + i);
+
+    for (i = 0; i < p; i++)
+        acb_poly_set_acb(tmp + i, a + i);
+    for (i = 0; i < q; i++)
+        acb_poly_set_acb(tmp + p + i, b + i);
+    acb_poly_one(tmp + p + q);
+    acb_poly_set_acb(tmp + p + q + 1, z);
+
+    acb_hypgeom_pfq_series_direct(tmp, tmp, p, tmp + p, q + 1,
+        tmp + p + q + 1, regularized, -1, 1, prec);
+
+    acb_poly_get_coeff_acb(res, tmp, 0);
+
+    for (i = 0; i < p + q + 2; i++)
+        acb_poly_clear(tmp + i);
+    flint_free(tmp);
+}
+
+void
+acb_hypgeom_pfq_precomp_eval(acb_t res, const acb_hypgeom_pfq_precomp_t pre,
+    const acb_t z, slong prec)
+{
+    acb_srcptr a = pre->a;
+    acb_srcptr b = pre->b;
+
+    switch (pre->algorithm)
+    {
+        case PFQ_EXP:
+            acb_exp(res, z, prec);
+            break;
+
+        case PFQ_POW:
+            {
+                acb_t t;
+                acb_init(t);
+                acb_neg(t, a);
+                acb_sub_ui(res, z, 1, prec);
+                acb_neg(res, res);
+                acb_pow(res, res, t, prec);
+                acb_clear(t);
+            }
+            break;
+
+        case PFQ_0F1:
+            acb_hypgeom_0f1(res, b, z, pre->regularized, prec);
+            break;
+
+        case PFQ_1F1:
+            acb_hypgeom_m(res, a, b, z, pre->regularized, prec);
+            break;
+
+        case PFQ_2F1:
+            _acb_hypgeom_2f1_precomp_eval(res, pre, z, prec);
+            break;
+
+        case PFQ_SERIES:
+            _acb_hypgeom_pfq_series_eval(res, a, pre->p, b, pre->q, z,
+                pre->regularized, prec);
+            break;
+
+        default:
+            {
+                acb_t t;
+                acb_init(t);
+
+                acb_hypgeom_pfq_direct(t, pre->da, pre->dp, pre->db, pre->dq,
+                    z, -1, prec);
+
+                if (pre->regularized && pre->q > 0)
+                {
+                    /* the cached prefactor is only as precise as
+                       the precision used to create pre */
+                    if (prec > pre->prec)
+                    {
+                        acb_t c;
+                        acb_init(c);
+                        _acb_hypgeom_rgamma_prod(c, b, pre->q, prec);
+                        acb_mul(t, t, c, prec);
+                        acb_clear(c);
+                    }
+                    else
+                    {
+                        acb_mul(t, t, &pre->c, prec);
+                    }
+                }
+
+                acb_swap(res, t);
+                acb_clear(t);
+            }
+    }
+
+    if (!acb_is_finite(res))
+        acb_indeterminate(res);
+}
+
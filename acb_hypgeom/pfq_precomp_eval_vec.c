@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "acb_hypgeom.h"
+
+typedef struct
+{
+    acb_ptr res;
+    const acb_hypgeom_pfq_precomp_struct * pre;
+    acb_srcptr z;
+    slong start;
+    slong step;
+    slong len;
+    slong prec;
+}
+pfq_eval_arg_t;
+
+static void *
+_acb_hypgeom_pfq_eval_worker(void * arg_ptr)
+{
+    pfq_eval_arg_t arg = *((pfq_eval_arg_t *) arg_ptr);
+    slong i;
+
+    for (i = arg.start; i < arg.len; i += arg.step)
+        acb_hypgeom_pfq_precomp_eval(arg.res + i, arg.pre, arg.z + i, arg.prec);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
+void
+acb_hypgeom_pfq_precomp_eval_vec(acb_ptr res, const acb_hypgeom_pfq_precomp_t pre,
+    acb_srcptr z, slong len, slong prec)
+{
+    pthread_t * threads;
+    pfq_eval_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_threads <= 1)
+    {
+        for (i = 0; i < len; i++)
+            acb_hypgeom_pfq_precomp_eval(res + i, pre, z + i, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(pfq_eval_arg_t) * num_threads);
+
+    /* the cost of an evaluation depends on the point, so the points
+       are distributed cyclically rather than in contiguous blocks */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = res;
+        args[i].pre = pre;
+        args[i].z = z;
+        args[i].start = i;
+        args[i].step = num_threads;
+        args[i].len = len;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, _acb_hypgeom_pfq_eval_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
@@ -10,6 +10,7 @@
 */
 
 #include "acb_hypgeom.h"
+#include "hypgeom.h"
 
 static void
 factor(acb_poly_t A, acb_poly_t tmp,
@@ -110,6 +111,117 @@ bsplit(acb_poly_t A1, acb_poly_t B1, acb_poly_t C1,
     }
 }
 
+typedef struct
+{
+    acb_poly_t A;
+    acb_poly_t B;
+    acb_poly_t C;
+}
+bsplit_res_t;
+
+typedef struct
+{
+    const acb_poly_struct * a;
+    slong p;
+    const acb_poly_struct * b;
+    slong q;
+    const acb_poly_struct * z;
+    slong len;
+    slong prec;
+}
+bsplit_args_t;
+
+static void
+bsplit_init(void * x, void * args)
+{
+    bsplit_res_t * r = x;
+    acb_poly_init(r->A);
+    acb_poly_init(r->B);
+    acb_poly_init(r->C);
+}
+
+static void
+bsplit_clear(void * x, void * args)
+{
+    bsplit_res_t * r = x;
+    acb_poly_clear(r->A);
+    acb_poly_clear(r->B);
+    acb_poly_clear(r->C);
+}
+
+static void
+bsplit_basecase(void * x, slong aa, slong bb, void * args)
+{
+    bsplit_res_t * r = x;
+    bsplit_args_t * s = args;
+
+    bsplit(r->A, r->B, r->C, s->a, s->p, s->b, s->q, s->z, aa, bb, s->len, s->prec);
+
+    if (bb - aa == 1)
+        acb_poly_set(r->B, r->C);
+}
+
+static void
+bsplit_merge(void * x, void * y, void * args)
+{
+    bsplit_res_t * r = x;
+    bsplit_res_t * r2 = y;
+    slong len = ((bsplit_args_t *) args)->len;
+    slong prec = ((bsplit_args_t *) args)->prec;
+    acb_poly_t tmp;
+
+    acb_poly_init(tmp);
+
+    acb_poly_mullow(tmp, r->B, r2->C, len, prec);
+    acb_poly_mullow(r->B, r->A, r2->B, len, prec);
+    acb_poly_add(r->B, r->B, tmp, prec);
+    acb_poly_mullow(tmp, r->A, r2->A, len, prec);
+    acb_poly_swap(r->A, tmp);
+    acb_poly_mullow(tmp, r->C, r2->C, len, prec);
+    acb_poly_swap(r->C, tmp);
+
+    acb_poly_clear(tmp);
+}
+
+/* evaluates the product tree using several threads when worthwhile */
+static void
+bsplit_parallel(acb_poly_t A1, acb_poly_t B1, acb_poly_t C1,
+        const acb_poly_struct * a, slong p,
+        const acb_poly_struct * b, slong q,
+        const acb_poly_t z,
+        slong aa,
+        slong bb,
+        slong len, slong prec)
+{
+    if (flint_get_num_threads() > 1 && bb - aa >= 64
+        && prec >= hypgeom_bsplit_threaded_cutoff)
+    {
+        bsplit_res_t r;
+        bsplit_args_t args;
+
+        args.a = a;
+        args.p = p;
+        args.b = b;
+        args.q = q;
+        args.z = z;
+        args.len = len;
+        args.prec = prec;
+
+        bsplit_init(&r, &args);
+        hypgeom_parallel_binary_splitting(&r, bsplit_basecase, bsplit_merge,
+            sizeof(bsplit_res_t), bsplit_init, bsplit_clear, &args,
+            aa, bb, 16, -1);
+        acb_poly_swap(A1, r.A);
+        acb_poly_swap(B1, r.B);
+        acb_poly_swap(C1, r.C);
+        bsplit_clear(&r, &args);
+    }
+    else
+    {
+        bsplit(A1, B1, C1, a, p, b, q, z, aa, bb, len, prec);
+    }
+}
+
 void
 acb_hypgeom_pfq_series_sum_bs(acb_poly_t s, acb_poly_t t,
     const acb_poly_struct * a, slong p,
@@ -187,7 +299,7 @@ acb_hypgeom_pfq_series_sum_bs(acb_poly_t s, acb_poly_t t,
     acb_poly_init(v);
     acb_poly_init(w);
 
-    bsplit(u, v, w, a, p, b, q, z, start, n, len, prec);
+    bsplit_parallel(u, v, w, a, p, b, q, z, start, n, len, prec);
 
     if (n - start == 1)
         acb_poly_set(v, w);  /* B1 not set */
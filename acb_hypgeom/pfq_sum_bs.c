@@ -10,6 +10,7 @@
 */
 
 #include "acb_hypgeom.h"
+#include "hypgeom.h"
 
 /*
 
@@ -116,6 +117,109 @@ bsplit(acb_t A1, acb_t B1, acb_t C1,
     }
 }
 
+typedef struct
+{
+    acb_t A;
+    acb_t B;
+    acb_t C;
+}
+bsplit_res_t;
+
+typedef struct
+{
+    acb_srcptr a;
+    slong p;
+    acb_srcptr b;
+    slong q;
+    acb_srcptr z;
+    slong prec;
+    int invz;
+}
+bsplit_args_t;
+
+static void
+bsplit_init(void * x, void * args)
+{
+    bsplit_res_t * r = x;
+    acb_init(r->A);
+    acb_init(r->B);
+    acb_init(r->C);
+}
+
+static void
+bsplit_clear(void * x, void * args)
+{
+    bsplit_res_t * r = x;
+    acb_clear(r->A);
+    acb_clear(r->B);
+    acb_clear(r->C);
+}
+
+static void
+bsplit_basecase(void * x, slong aa, slong bb, void * args)
+{
+    bsplit_res_t * r = x;
+    bsplit_args_t * s = args;
+
+    bsplit(r->A, r->B, r->C, s->a, s->p, s->b, s->q, s->z, aa, bb, s->prec, s->invz);
+
+    if (bb - aa == 1)
+        acb_set(r->B, r->C);
+}
+
+static void
+bsplit_merge(void * x, void * y, void * args)
+{
+    bsplit_res_t * r = x;
+    bsplit_res_t * r2 = y;
+    slong prec = ((bsplit_args_t *) args)->prec;
+
+    acb_mul(r->B, r->B, r2->C, prec);
+    acb_addmul(r->B, r->A, r2->B, prec);
+    acb_mul(r->A, r->A, r2->A, prec);
+    acb_mul(r->C, r->C, r2->C, prec);
+}
+
+/* evaluates the product tree using several threads when worthwhile */
+static void
+bsplit_parallel(acb_t A1, acb_t B1, acb_t C1,
+        acb_srcptr a, slong p,
+        acb_srcptr b, slong q,
+        const acb_t z,
+        slong aa,
+        slong bb,
+        slong prec,
+        int invz)
+{
+    if (flint_get_num_threads() > 1 && bb - aa >= 64
+        && prec >= hypgeom_bsplit_threaded_cutoff)
+    {
+        bsplit_res_t r;
+        bsplit_args_t args;
+
+        args.a = a;
+        args.p = p;
+        args.b = b;
+        args.q = q;
+        args.z = z;
+        args.prec = prec;
+        args.invz = invz;
+
+        bsplit_init(&r, &args);
+        hypgeom_parallel_binary_splitting(&r, bsplit_basecase, bsplit_merge,
+            sizeof(bsplit_res_t), bsplit_init, bsplit_clear, &args,
+            aa, bb, 16, -1);
+        acb_swap(A1, r.A);
+        acb_swap(B1, r.B);
+        acb_swap(C1, r.C);
+        bsplit_clear(&r, &args);
+    }
+    else
+    {
+        bsplit(A1, B1, C1, a, p, b, q, z, aa, bb, prec, invz);
+    }
+}
+
 void
 acb_hypgeom_pfq_sum_bs(acb_t s, acb_t t,
     acb_srcptr a, slong p, acb_srcptr b, slong q, const acb_t z, slong n, slong prec)
@@ -136,7 +240,7 @@ acb_hypgeom_pfq_sum_bs(acb_t s, acb_t t,
     /* we compute to n-1 instead of n to avoid dividing by 0 in the
        denominator when computing a hypergeometric polynomial
        that terminates right before a pole */
-    bsplit(u, v, w, a, p, b, q, z, 0, n - 1, prec, 0);
+    bsplit_parallel(u, v, w, a, p, b, q, z, 0, n - 1, prec, 0);
 
     acb_add(s, u, v, prec); /* s = s + t */
     acb_div(s, s, w, prec);
@@ -177,7 +281,7 @@ acb_hypgeom_pfq_sum_bs_invz(acb_t s, acb_t t,
     /* we compute to n-1 instead of n to avoid dividing by 0 in the
        denominator when computing a hypergeometric polynomial
        that terminates right before a pole */
-    bsplit(u, v, w, a, p, b, q, z, 0, n - 1, prec, 1);
+    bsplit_parallel(u, v, w, a, p, b, q, z, 0, n - 1, prec, 1);
 
     acb_add(s, u, v, prec); /* s = s + t */
     acb_div(s, s, w, prec);
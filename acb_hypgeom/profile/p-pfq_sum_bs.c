@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "acb_hypgeom.h"
+#include "hypgeom.h"
+#include "flint/profiler.h"
+
+/*
+    Times binary splitting summation of a 1F1 series with
+    acb_hypgeom_pfq_sum_bs and of the series for e with arb_hypgeom_infsum
+    for increasing thread counts, and prints the speedup over one thread.
+
+    usage: p-pfq_sum_bs [max_threads]
+*/
+
+static double
+time_pfq(acb_srcptr a, acb_srcptr b, const acb_t z, slong n, slong prec)
+{
+    timeit_t timer;
+    acb_t s, t;
+
+    acb_init(s);
+    acb_init(t);
+
+    timeit_start(timer);
+    acb_hypgeom_pfq_sum_bs(s, t, a, 1, b, 1, z, n, prec);
+    timeit_stop(timer);
+
+    acb_clear(s);
+    acb_clear(t);
+
+    return (double) timer->wall;
+}
+
+static double
+time_e(slong prec)
+{
+    timeit_t timer;
+    hypgeom_t hyp;
+    arb_t P, Q;
+
+    hypgeom_init(hyp);
+    arb_init(P);
+    arb_init(Q);
+
+    fmpz_poly_set_si(hyp->A, 1);
+    fmpz_poly_set_si(hyp->B, 1);
+    fmpz_poly_set_si(hyp->P, 1);
+    fmpz_poly_set_coeff_si(hyp->Q, 1, 1);
+
+    timeit_start(timer);
+    arb_hypgeom_infsum(P, Q, hyp, prec, prec);
+    timeit_stop(timer);
+
+    hypgeom_clear(hyp);
+    arb_clear(P);
+    arb_clear(Q);
+
+    return (double) timer->wall;
+}
+
+int main(int argc, char *argv[])
+{
+    slong prec_tab[3] = { 10000, 100000, 1000000 };
+    slong j, n, prec, threads, max_threads;
+    double t_pfq, t_e, t_pfq_1 = 0.0, t_e_1 = 0.0;
+    acb_t a, b, z;
+    mag_t zmag;
+
+    max_threads = (argc > 1) ? atol(argv[1]) : 8;
+
+    acb_init(a);
+    acb_init(b);
+    acb_init(z);
+    mag_init(zmag);
+
+    /* erf-type series 1F1(1/2, 3/2, -1/4) */
+    acb_set_d(a, 0.5);
+    acb_set_d(b, 1.5);
+    acb_set_d(z, -0.25);
+    acb_get_mag(zmag, z);
+
+    for (j = 0; j < 3; j++)
+    {
+        prec = prec_tab[j];
+        n = hypgeom_estimate_terms(zmag, 1, prec);
+
+        flint_printf("prec = %wd, n = %wd\n", prec, n);
+        flint_printf("%8s %12s %8s %12s %8s\n", "threads",
+            "pfq_sum_bs", "speedup", "infsum(e)", "speedup");
+
+        for (threads = 1; threads <= max_threads; threads *= 2)
+        {
+            flint_set_num_threads(threads);
+
+            t_pfq = time_pfq(a, b, z, n, prec);
+            t_e = time_e(prec);
+
+            if (threads == 1)
+            {
+                t_pfq_1 = t_pfq;
+                t_e_1 = t_e;
+            }
+
+            flint_printf("%8wd %12g %8.3f %12g %8.3f\n", threads,
+                t_pfq, t_pfq_1 / FLINT_MAX(t_pfq, 1),
+                t_e, t_e_1 / FLINT_MAX(t_e, 1));
+        }
+
+        flint_printf("\n");
+    }
+
+    acb_clear(a);
+    acb_clear(b);
+    acb_clear(z);
+    mag_clear(zmag);
+
+    flint_cleanup();
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+typedef void (*bessel_func_t)(acb_t, const acb_t, const acb_t, slong);
+typedef void (*bessel_vec_func_t)(acb_ptr, const acb_t, const acb_t, slong, slong);
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    bessel_func_t func[6] = {
+        acb_hypgeom_bessel_j, acb_hypgeom_bessel_y,
+        acb_hypgeom_bessel_i, acb_hypgeom_bessel_i_scaled,
+        acb_hypgeom_bessel_k, acb_hypgeom_bessel_k_scaled };
+
+    bessel_vec_func_t vec_func[6] = {
+        acb_hypgeom_bessel_j_vec, acb_hypgeom_bessel_y_vec,
+        acb_hypgeom_bessel_i_vec, acb_hypgeom_bessel_i_scaled_vec,
+        acb_hypgeom_bessel_k_vec, acb_hypgeom_bessel_k_scaled_vec };
+
+    flint_printf("bessel_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr res;
+        acb_t nu, z, t, y;
+        slong k, len, prec1, prec2;
+        int which;
+
+        acb_init(nu);
+        acb_init(z);
+        acb_init(t);
+        acb_init(y);
+
+        which = n_randint(state, 6);
+        len = n_randint(state, 30);
+        prec1 = 2 + n_randint(state, 200);
+        prec2 = 2 + n_randint(state, 200);
+
+        if (n_randint(state, 2))
+            acb_set_si(nu, n_randint(state, 10));
+        else
+            acb_randtest(nu, state, 1 + n_randint(state, 200), 3);
+
+        acb_randtest(z, state, 1 + n_randint(state, 200), 4);
+
+        res = _acb_vec_init(len);
+
+        vec_func[which](res, nu, z, len, prec1);
+
+        for (k = 0; k < len; k++)
+        {
+            acb_add_si(t, nu, k, prec2);
+            func[which](y, t, z, prec2);
+
+            if (!acb_overlaps(res + k, y))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("which = %d, len = %wd, k = %wd\n\n", which, len, k);
+                flint_printf("nu = "); acb_printd(nu, 30); flint_printf("\n\n");
+                flint_printf("z = "); acb_printd(z, 30); flint_printf("\n\n");
+                flint_printf("res = "); acb_printd(res + k, 30); flint_printf("\n\n");
+                flint_printf("y = "); acb_printd(y, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(res, len);
+
+        acb_clear(nu);
+        acb_clear(z);
+        acb_clear(t);
+        acb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
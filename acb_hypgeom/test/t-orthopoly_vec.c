@@ -0,0 +1,196 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+/* value of the degree-n polynomial (or of its derivative) via the
+   single-degree functions and the standard differentiation formulas */
+static void
+ortho_ref(acb_t res, int kind, int deriv, slong n,
+    const acb_t a, const acb_t b, const acb_t z, slong prec)
+{
+    acb_t nn, t, u, a1, b1;
+
+    acb_init(nn);
+    acb_init(t);
+    acb_init(u);
+    acb_init(a1);
+    acb_init(b1);
+
+    acb_set_si(nn, n);
+
+    if (!deriv)
+    {
+        switch (kind)
+        {
+            case 0: acb_hypgeom_legendre_p(res, nn, t, z, 0, prec); break;
+            case 1: acb_hypgeom_chebyshev_t(res, nn, z, prec); break;
+            case 2: acb_hypgeom_hermite_h(res, nn, z, prec); break;
+            case 3: acb_hypgeom_laguerre_l(res, nn, a, z, prec); break;
+            case 4: acb_hypgeom_gegenbauer_c(res, nn, a, z, prec); break;
+            default: acb_hypgeom_jacobi_p(res, nn, a, b, z, prec);
+        }
+    }
+    else if (n == 0)
+    {
+        acb_zero(res);
+    }
+    else
+    {
+        acb_add_ui(a1, a, 1, prec);
+        acb_add_ui(b1, b, 1, prec);
+        acb_set_si(nn, n - 1);
+
+        switch (kind)
+        {
+            case 0:
+                /* (1 - z^2) P_n' = n (P_{n-1} - z P_n) */
+                ortho_ref(t, 0, 0, n - 1, a, b, z, prec);
+                ortho_ref(u, 0, 0, n, a, b, z, prec);
+                acb_submul(t, u, z, prec);
+                acb_mul_si(t, t, n, prec);
+                acb_one(u);
+                acb_submul(u, z, z, prec);
+                acb_div(res, t, u, prec);
+                break;
+            case 1:
+                acb_hypgeom_chebyshev_u(res, nn, z, prec);
+                acb_mul_si(res, res, n, prec);
+                break;
+            case 2:
+                acb_hypgeom_hermite_h(res, nn, z, prec);
+                acb_mul_si(res, res, 2 * n, prec);
+                break;
+            case 3:
+                acb_hypgeom_laguerre_l(res, nn, a1, z, prec);
+                acb_neg(res, res);
+                break;
+            case 4:
+                acb_hypgeom_gegenbauer_c(res, nn, a1, z, prec);
+                acb_mul(res, res, a, prec);
+                acb_mul_2exp_si(res, res, 1);
+                break;
+            default:
+                acb_hypgeom_jacobi_p(res, nn, a1, b1, z, prec);
+                acb_add(t, a, b, prec);
+                acb_add_si(t, t, n + 1, prec);
+                acb_mul(res, res, t, prec);
+                acb_mul_2exp_si(res, res, -1);
+        }
+    }
+
+    acb_clear(nn);
+    acb_clear(t);
+    acb_clear(u);
+    acb_clear(a1);
+    acb_clear(b1);
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("orthopoly_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr z, res, res_prime;
+        acb_t a, b, t;
+        slong i, n, num, len, prec;
+        int kind, deriv;
+
+        kind = n_randint(state, 6);
+        deriv = n_randint(state, 2);
+        num = 1 + n_randint(state, 20);
+        len = n_randint(state, 20);
+        prec = 2 + n_randint(state, 200);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        z = _acb_vec_init(num);
+        res = _acb_vec_init(num * len);
+        res_prime = _acb_vec_init(num * len);
+        acb_init(a);
+        acb_init(b);
+        acb_init(t);
+
+        for (i = 0; i < num; i++)
+            acb_randtest(z + i, state, 1 + n_randint(state, 200), 2);
+
+        /* keep the parameters away from degenerate cases */
+        acb_set_ui(a, 1 + n_randint(state, 8));
+        acb_mul_2exp_si(a, a, -1);
+        acb_set_ui(b, n_randint(state, 8));
+        acb_mul_2exp_si(b, b, -1);
+
+        switch (kind)
+        {
+            case 0: acb_hypgeom_legendre_p_vec(res, deriv ? res_prime : NULL, z, num, len, prec); break;
+            case 1: acb_hypgeom_chebyshev_t_vec(res, deriv ? res_prime : NULL, z, num, len, prec); break;
+            case 2: acb_hypgeom_hermite_h_vec(res, deriv ? res_prime : NULL, z, num, len, prec); break;
+            case 3: acb_hypgeom_laguerre_l_vec(res, deriv ? res_prime : NULL, a, z, num, len, prec); break;
+            case 4: acb_hypgeom_gegenbauer_c_vec(res, deriv ? res_prime : NULL, a, z, num, len, prec); break;
+            default: acb_hypgeom_jacobi_p_vec(res, deriv ? res_prime : NULL, a, b, z, num, len, prec);
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            for (n = 0; n < len; n++)
+            {
+                ortho_ref(t, kind, 0, n, a, b, z + i, prec);
+
+                if (!acb_overlaps(t, res + i * len + n))
+                {
+                    flint_printf("FAIL: value (kind = %d, i = %wd, n = %wd)\n\n", kind, i, n);
+                    flint_printf("z = "); acb_printd(z + i, 30); flint_printf("\n\n");
+                    flint_printf("a = "); acb_printd(a, 30); flint_printf("\n\n");
+                    flint_printf("b = "); acb_printd(b, 30); flint_printf("\n\n");
+                    flint_printf("res = "); acb_printd(res + i * len + n, 30); flint_printf("\n\n");
+                    flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                    flint_abort();
+                }
+
+                if (deriv)
+                {
+                    ortho_ref(t, kind, 1, n, a, b, z + i, prec);
+
+                    if (!acb_overlaps(t, res_prime + i * len + n))
+                    {
+                        flint_printf("FAIL: derivative (kind = %d, i = %wd, n = %wd)\n\n", kind, i, n);
+                        flint_printf("z = "); acb_printd(z + i, 30); flint_printf("\n\n");
+                        flint_printf("a = "); acb_printd(a, 30); flint_printf("\n\n");
+                        flint_printf("b = "); acb_printd(b, 30); flint_printf("\n\n");
+                        flint_printf("res = "); acb_printd(res_prime + i * len + n, 30); flint_printf("\n\n");
+                        flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                        flint_abort();
+                    }
+                }
+            }
+        }
+
+        _acb_vec_clear(z, num);
+        _acb_vec_clear(res, num * len);
+        _acb_vec_clear(res_prime, num * len);
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
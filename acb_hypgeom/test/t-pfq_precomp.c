@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("pfq_precomp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        acb_hypgeom_pfq_precomp_t pre;
+        acb_ptr a, b, z, res;
+        acb_t y;
+        slong i, j, p, q, len, prec0, prec1, prec2;
+        int regularized;
+
+        p = n_randint(state, 4);
+        q = n_randint(state, 4);
+
+        /* exercise the cached 2F1 transformations */
+        if (iter % 4 == 0)
+        {
+            p = 2;
+            q = 1;
+        }
+        len = n_randint(state, 10);
+        regularized = n_randint(state, 2);
+        prec0 = 2 + n_randint(state, 200);
+        prec1 = 2 + n_randint(state, 200);
+        prec2 = 2 + n_randint(state, 200);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        a = _acb_vec_init(p);
+        b = _acb_vec_init(q);
+        z = _acb_vec_init(len);
+        res = _acb_vec_init(len);
+        acb_init(y);
+
+        for (i = 0; i < p; i++)
+        {
+            if (n_randint(state, 4) == 0)
+                acb_one(a + i);
+            else
+                acb_randtest(a + i, state, 1 + n_randint(state, 100), 2);
+        }
+
+        for (i = 0; i < q; i++)
+        {
+            if (n_randint(state, 4) == 0)
+                acb_set_si(b + i, -(slong) n_randint(state, 3));
+            else
+                acb_randtest(b + i, state, 1 + n_randint(state, 100), 2);
+        }
+
+        for (i = 0; i < len; i++)
+            acb_randtest(z + i, state, 1 + n_randint(state, 100), 2);
+
+        acb_hypgeom_pfq_precomp_init(pre, a, p, b, q, regularized, prec0);
+
+        if (len > 0 && n_randint(state, 2))
+        {
+            /* aliasing */
+            _acb_vec_set(res, z, len);
+            acb_hypgeom_pfq_precomp_eval_vec(res, pre, res, len, prec1);
+        }
+        else
+        {
+            acb_hypgeom_pfq_precomp_eval_vec(res, pre, z, len, prec1);
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            acb_hypgeom_pfq(y, a, p, b, q, z + i, regularized, prec2);
+
+            if (!acb_overlaps(res + i, y))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("p = %wd, q = %wd, regularized = %d, i = %wd\n\n",
+                    p, q, regularized, i);
+                for (j = 0; j < p; j++)
+                {
+                    flint_printf("a[%wd] = ", j); acb_printd(a + j, 15); flint_printf("\n\n");
+                }
+                for (j = 0; j < q; j++)
+                {
+                    flint_printf("b[%wd] = ", j); acb_printd(b + j, 15); flint_printf("\n\n");
+                }
+                flint_printf("z = "); acb_printd(z + i, 15); flint_printf("\n\n");
+                flint_printf("res = "); acb_printd(res + i, 15); flint_printf("\n\n");
+                flint_printf("y = "); acb_printd(y, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_hypgeom_pfq_precomp_clear(pre);
+
+        _acb_vec_clear(a, p);
+        _acb_vec_clear(b, q);
+        _acb_vec_clear(z, len);
+        _acb_vec_clear(res, len);
+        acb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,135 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+#include "hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("pfq_sum_bs_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* exercise the threaded code at small precision */
+    hypgeom_bsplit_threaded_cutoff = 0;
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr a, b;
+        acb_poly_struct * ap, * bp;
+        acb_poly_t zp, sp1, sp2, tp1, tp2;
+        acb_t z, s1, s2, t1, t2;
+        slong i, p, q, n, len, prec1, prec2;
+
+        p = n_randint(state, 4);
+        q = n_randint(state, 4);
+        n = n_randint(state, 400);
+        len = 1 + n_randint(state, 4);
+        prec1 = 2 + n_randint(state, 300);
+        prec2 = 2 + n_randint(state, 300);
+
+        flint_set_num_threads(1 + n_randint(state, 5));
+
+        acb_init(z);
+        acb_init(s1);
+        acb_init(s2);
+        acb_init(t1);
+        acb_init(t2);
+        acb_poly_init(zp);
+        acb_poly_init(sp1);
+        acb_poly_init(sp2);
+        acb_poly_init(tp1);
+        acb_poly_init(tp2);
+
+        acb_randtest(z, state, 1 + n_randint(state, 300), 1 + n_randint(state, 3));
+
+        a = _acb_vec_init(p);
+        b = _acb_vec_init(q);
+        ap = flint_malloc(sizeof(acb_poly_struct) * p);
+        bp = flint_malloc(sizeof(acb_poly_struct) * q);
+
+        for (i = 0; i < p; i++)
+        {
+            acb_randtest(a + i, state, 1 + n_randint(state, 100), 1 + n_randint(state, 10));
+            acb_poly_init(ap + i);
+            acb_poly_set_acb(ap + i, a + i);
+        }
+
+        for (i = 0; i < q; i++)
+        {
+            acb_randtest(b + i, state, 1 + n_randint(state, 100), 1 + n_randint(state, 10));
+            acb_poly_init(bp + i);
+            acb_poly_set_acb(bp + i, b + i);
+        }
+
+        acb_poly_set_coeff_acb(zp, 0, z);
+        acb_poly_set_coeff_si(zp, 1, 1);
+
+        acb_hypgeom_pfq_sum_forward(s1, t1, a, p, b, q, z, n, prec1);
+        acb_hypgeom_pfq_sum_bs(s2, t2, a, p, b, q, z, n, prec2);
+
+        if (!acb_overlaps(s1, s2) || !acb_overlaps(t1, t2))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("n = %wd\n\n", n);
+            flint_printf("z = "); acb_printd(z, 30); flint_printf("\n\n");
+            flint_printf("s1 = "); acb_printd(s1, 30); flint_printf("\n\n");
+            flint_printf("s2 = "); acb_printd(s2, 30); flint_printf("\n\n");
+            flint_printf("t1 = "); acb_printd(t1, 30); flint_printf("\n\n");
+            flint_printf("t2 = "); acb_printd(t2, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        acb_hypgeom_pfq_series_sum_forward(sp1, tp1, ap, p, bp, q, zp, 0, n, len, prec1);
+        acb_hypgeom_pfq_series_sum_bs(sp2, tp2, ap, p, bp, q, zp, 0, n, len, prec2);
+
+        if (!acb_poly_overlaps(sp1, sp2) || !acb_poly_overlaps(tp1, tp2))
+        {
+            flint_printf("FAIL: overlap (series)\n\n");
+            flint_printf("n = %wd, len = %wd\n\n", n, len);
+            flint_printf("sp1 = "); acb_poly_printd(sp1, 30); flint_printf("\n\n");
+            flint_printf("sp2 = "); acb_poly_printd(sp2, 30); flint_printf("\n\n");
+            flint_printf("tp1 = "); acb_poly_printd(tp1, 30); flint_printf("\n\n");
+            flint_printf("tp2 = "); acb_poly_printd(tp2, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        for (i = 0; i < p; i++)
+            acb_poly_clear(ap + i);
+        for (i = 0; i < q; i++)
+            acb_poly_clear(bp + i);
+        flint_free(ap);
+        flint_free(bp);
+        _acb_vec_clear(a, p);
+        _acb_vec_clear(b, q);
+
+        acb_clear(z);
+        acb_clear(s1);
+        acb_clear(s2);
+        acb_clear(t1);
+        acb_clear(t2);
+        acb_poly_clear(zp);
+        acb_poly_clear(sp1);
+        acb_poly_clear(sp2);
+        acb_poly_clear(tp1);
+        acb_poly_clear(tp2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -44,9 +44,18 @@ clear_shallow(arb_mat_t X)
             arb_init(arb_mat_entry(X, i, j));
 }
 
+static void
+_arb_mat_mul_part(arb_mat_t Z, const arb_mat_t X, const arb_mat_t Y, int block, slong prec)
+{
+    if (block)
+        arb_mat_mul_block(Z, X, Y, prec);
+    else
+        arb_mat_mul(Z, X, Y, prec);
+}
+
 /* todo: squaring optimizations */
-void
-acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
+static void
+_acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, int block, slong prec)
 {
     arb_mat_t X, Y, Z, W;
     slong M, N, P;
@@ -73,7 +82,7 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
 
             if (A == C || B == C)
             {
-                arb_mat_mul(Z, X, Y, prec);
+                _arb_mat_mul_part(Z, X, Y, block, prec);
 
                 for (i = 0; i < M; i++)
                     for (j = 0; j < P; j++)
@@ -82,7 +91,7 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
             else
             {
                 copy_re_shallow(Z, C);
-                arb_mat_mul(Z, X, Y, prec);
+                _arb_mat_mul_part(Z, X, Y, block, prec);
 
                 for (i = 0; i < M; i++)
                     for (j = 0; j < P; j++)
@@ -114,9 +123,9 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
                 arb_mat_t T;
                 arb_mat_init(T, M, P);
 
-                arb_mat_mul(T, X, Y, prec);
+                _arb_mat_mul_part(T, X, Y, block, prec);
                 copy_im_shallow(Y, B);
-                arb_mat_mul(Z, X, Y, prec);
+                _arb_mat_mul_part(Z, X, Y, block, prec);
 
                 for (i = 0; i < M; i++)
                     for (j = 0; j < P; j++)
@@ -131,7 +140,7 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
             else
             {
                 copy_re_shallow(Z, C);
-                arb_mat_mul(Z, X, Y, prec);
+                _arb_mat_mul_part(Z, X, Y, block, prec);
 
                 for (i = 0; i < M; i++)
                     for (j = 0; j < P; j++)
@@ -139,7 +148,7 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
 
                 copy_im_shallow(Z, C);
                 copy_im_shallow(Y, B);
-                arb_mat_mul(Z, X, Y, prec);
+                _arb_mat_mul_part(Z, X, Y, block, prec);
 
                 for (i = 0; i < M; i++)
                     for (j = 0; j < P; j++)
@@ -172,9 +181,9 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
             arb_mat_t T;
             arb_mat_init(T, M, P);
 
-            arb_mat_mul(T, X, Y, prec);
+            _arb_mat_mul_part(T, X, Y, block, prec);
             copy_im_shallow(X, A);
-            arb_mat_mul(Z, X, Y, prec);
+            _arb_mat_mul_part(Z, X, Y, block, prec);
 
             for (i = 0; i < M; i++)
                 for (j = 0; j < P; j++)
@@ -189,7 +198,7 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
         else
         {
             copy_re_shallow(Z, C);
-            arb_mat_mul(Z, X, Y, prec);
+            _arb_mat_mul_part(Z, X, Y, block, prec);
 
             for (i = 0; i < M; i++)
                 for (j = 0; j < P; j++)
@@ -197,7 +206,7 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
 
             copy_im_shallow(Z, C);
             copy_im_shallow(X, A);
-            arb_mat_mul(Z, X, Y, prec);
+            _arb_mat_mul_part(Z, X, Y, block, prec);
 
             for (i = 0; i < M; i++)
                 for (j = 0; j < P; j++)
@@ -222,11 +231,11 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
 
         copy_re_shallow(X, A);
         copy_re_shallow(Y, B);
-        arb_mat_mul(Z, X, Y, prec);
+        _arb_mat_mul_part(Z, X, Y, block, prec);
 
         copy_im_shallow(X, A);
         copy_im_shallow(Y, B);
-        arb_mat_mul(W, X, Y, prec);
+        _arb_mat_mul_part(W, X, Y, block, prec);
 
         if (A == C || B == C)
         {
@@ -235,11 +244,11 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
             arb_mat_sub(T, Z, W, prec);
 
             copy_re_shallow(X, A);
-            arb_mat_mul(Z, X, Y, prec);
+            _arb_mat_mul_part(Z, X, Y, block, prec);
 
             copy_im_shallow(X, A);
             copy_re_shallow(Y, B);
-            arb_mat_mul(W, X, Y, prec);
+            _arb_mat_mul_part(W, X, Y, block, prec);
 
             for (i = 0; i < M; i++)
                 for (j = 0; j < P; j++)
@@ -261,11 +270,11 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
                         arb_mat_entry(Z, i, j), arb_mat_entry(W, i, j), prec);
 
             copy_re_shallow(X, A);
-            arb_mat_mul(Z, X, Y, prec);
+            _arb_mat_mul_part(Z, X, Y, block, prec);
 
             copy_im_shallow(X, A);
             copy_re_shallow(Y, B);
-            arb_mat_mul(W, X, Y, prec);
+            _arb_mat_mul_part(W, X, Y, block, prec);
 
             for (i = 0; i < M; i++)
                 for (j = 0; j < P; j++)
@@ -283,3 +292,15 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
     }
 }
 
+
+void
+acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
+{
+    _acb_mat_mul_reorder(C, A, B, 0, prec);
+}
+
+void
+acb_mat_mul_reorder_block(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
+{
+    _acb_mat_mul_reorder(C, A, B, 1, prec);
+}
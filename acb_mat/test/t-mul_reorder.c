@@ -85,6 +85,17 @@ int main()
             flint_abort();
         }
 
+        /* block variant */
+        acb_mat_mul_reorder_block(d, a, b, rbits3);
+
+        if (!acb_mat_contains_fmpq_mat(d, C))
+        {
+            flint_printf("FAIL (block)\n\n");
+            flint_printf("m = %wd, n = %wd, k = %wd, bits3 = %wd\n", m, n, k, rbits3);
+            flint_printf("d = "); acb_mat_printd(d, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
         /* test aliasing with a */
         if (acb_mat_nrows(a) == acb_mat_nrows(c) &&
             acb_mat_ncols(a) == acb_mat_ncols(c))
@@ -151,6 +151,11 @@ void acb_poly_evaluate_horner(acb_t res, const acb_poly_t f, const acb_t a, slon
 void _acb_poly_evaluate_rectangular(acb_t y, acb_srcptr poly, slong len, const acb_t x, slong prec);
 void acb_poly_evaluate_rectangular(acb_t res, const acb_poly_t f, const acb_t a, slong prec);
 
+void _acb_poly_evaluate_rectangular_multi(acb_ptr ys, acb_srcptr * polys,
+    const slong * lens, slong num, const acb_t x, slong prec);
+void acb_poly_evaluate_multi(acb_ptr ys, const acb_poly_struct * polys,
+    slong num, const acb_t x, slong prec);
+
 void _acb_poly_evaluate(acb_t res, acb_srcptr f, slong len, const acb_t a, slong prec);
 void acb_poly_evaluate(acb_t res, const acb_poly_t f, const acb_t a, slong prec);
 
@@ -393,6 +398,13 @@ void _acb_poly_taylor_shift_convolution(acb_ptr poly, const acb_t c, slong n, sl
 
 void acb_poly_taylor_shift_convolution(acb_poly_t g, const acb_poly_t f, const acb_t c, slong prec);
 
+void _acb_poly_taylor_shift_threaded(acb_ptr poly, const acb_t c, slong n, slong prec);
+
+void acb_poly_taylor_shift_threaded(acb_poly_t g, const acb_poly_t f, const acb_t c, slong prec);
+
+ARB_DLL extern slong acb_poly_taylor_shift_horner_cutoff;
+ARB_DLL extern slong acb_poly_taylor_shift_threaded_cutoff;
+
 void _acb_poly_taylor_shift(acb_ptr poly, const acb_t c, slong n, slong prec);
 
 void acb_poly_taylor_shift(acb_poly_t g, const acb_poly_t f, const acb_t c, slong prec);
@@ -466,6 +478,18 @@ void
 acb_poly_evaluate_vec_fast(acb_ptr ys,
         const acb_poly_t poly, acb_srcptr xs, slong n, slong prec);
 
+void
+_acb_poly_evaluate_vec_fast_precomp_threaded(acb_ptr vs, acb_srcptr poly,
+    slong plen, acb_ptr * tree, slong len, slong prec);
+
+void
+_acb_poly_evaluate_vec_fast_precomp_multi(acb_ptr ys, acb_srcptr * polys,
+    const slong * plens, slong num, acb_ptr * tree, slong len, slong prec);
+
+void
+acb_poly_evaluate_vec_fast_multi(acb_ptr ys, const acb_poly_struct * polys,
+    slong num, acb_srcptr xs, slong n, slong prec);
+
 void
 _acb_poly_evaluate_vec_iter(acb_ptr ys, acb_srcptr poly, slong plen,
     acb_srcptr xs, slong n, slong prec);
@@ -491,6 +515,11 @@ _acb_poly_interpolate_fast_precomp(acb_ptr poly,
     acb_srcptr ys, acb_ptr * tree, acb_srcptr weights,
     slong len, slong prec);
 
+void
+_acb_poly_interpolate_fast_precomp_threaded(acb_ptr poly,
+    acb_srcptr ys, acb_ptr * tree, acb_srcptr weights,
+    slong len, slong prec);
+
 void
 _acb_poly_interpolate_fast(acb_ptr poly,
     acb_srcptr xs, acb_srcptr ys, slong len, slong prec);
@@ -520,6 +549,10 @@ void _acb_poly_tree_free(acb_ptr * tree, slong len);
 void
 _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, slong len, slong prec);
 
+void
+_acb_poly_tree_build_threaded(acb_ptr * tree, acb_srcptr roots,
+    slong len, slong prec);
+
 
 void _acb_poly_root_inclusion(acb_t r, const acb_t m,
     acb_srcptr poly,
@@ -47,7 +47,13 @@ _acb_poly_compose_series_brent_kung(acb_ptr res,
     for (i = 2; i < m; i++)
         _acb_poly_mullow(A->rows[i], A->rows[(i + 1) / 2], n, A->rows[i / 2], n, n, prec);
 
-    acb_mat_mul(C, B, A, prec);
+    /* The product is m x m times m x n with n ~ m^2; see the comment
+       in _arb_poly_compose_series_brent_kung, which uses the same
+       precision and thread gating. */
+    if (m >= 16 && prec < 8000 && flint_get_num_threads() == 1)
+        acb_mat_mul_reorder_block(C, B, A, prec);
+    else
+        acb_mat_mul(C, B, A, prec);
 
     /* Evaluate block composition using the Horner scheme */
     _acb_vec_set(res, C->rows[m - 1], n);
@@ -121,8 +121,18 @@ void _acb_poly_evaluate_vec_fast(acb_ptr ys, acb_srcptr poly, slong plen,
     acb_ptr * tree;
 
     tree = _acb_poly_tree_alloc(n);
-    _acb_poly_tree_build(tree, xs, n, prec);
-    _acb_poly_evaluate_vec_fast_precomp(ys, poly, plen, tree, n, prec);
+
+    if (flint_get_num_threads() > 1 && n >= 64 && (double) n * prec >= 16384)
+    {
+        _acb_poly_tree_build_threaded(tree, xs, n, prec);
+        _acb_poly_evaluate_vec_fast_precomp_threaded(ys, poly, plen, tree, n, prec);
+    }
+    else
+    {
+        _acb_poly_tree_build(tree, xs, n, prec);
+        _acb_poly_evaluate_vec_fast_precomp(ys, poly, plen, tree, n, prec);
+    }
+
     _acb_poly_tree_free(tree, n);
 }
 
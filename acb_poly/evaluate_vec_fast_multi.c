@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "acb_poly.h"
+
+typedef struct
+{
+    acb_ptr ys;
+    acb_srcptr * polys;
+    const slong * plens;
+    acb_ptr * tree;
+    slong len;
+    slong k0;
+    slong k1;
+    slong prec;
+}
+multi_arg_t;
+
+static void *
+multi_worker(void * arg_ptr)
+{
+    multi_arg_t arg = *((multi_arg_t *) arg_ptr);
+    slong k;
+
+    for (k = arg.k0; k < arg.k1; k++)
+        _acb_poly_evaluate_vec_fast_precomp(arg.ys + k * arg.len,
+            arg.polys[k], arg.plens[k], arg.tree, arg.len, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_acb_poly_evaluate_vec_fast_precomp_multi(acb_ptr ys, acb_srcptr * polys,
+    const slong * plens, slong num, acb_ptr * tree, slong len, slong prec)
+{
+    slong i, num_threads;
+    pthread_t * threads;
+    multi_arg_t * args;
+
+    num_threads = flint_get_num_threads();
+
+    /* with few polynomials, parallelize each remainder tree instead */
+    if (num_threads <= 1 || num < num_threads)
+    {
+        for (i = 0; i < num; i++)
+            _acb_poly_evaluate_vec_fast_precomp_threaded(ys + i * len,
+                polys[i], plens[i], tree, len, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(multi_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].ys = ys;
+        args[i].polys = polys;
+        args[i].plens = plens;
+        args[i].tree = tree;
+        args[i].len = len;
+        args[i].k0 = (num * i) / num_threads;
+        args[i].k1 = (num * (i + 1)) / num_threads;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, multi_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void
+acb_poly_evaluate_vec_fast_multi(acb_ptr ys, const acb_poly_struct * polys,
+    slong num, acb_srcptr xs, slong n, slong prec)
+{
+    acb_ptr * tree;
+    acb_srcptr * ptrs;
+    slong * lens;
+    slong i;
+
+    if (n == 0 || num == 0)
+        return;
+
+    ptrs = flint_malloc(sizeof(acb_srcptr) * num);
+    lens = flint_malloc(sizeof(slong) * num);
+
+    for (i = 0; i < num; i++)
+    {
+        ptrs[i] = polys[i].coeffs;
+        lens[i] = polys[i].length;
+    }
+
+    tree = _acb_poly_tree_alloc(n);
+    _acb_poly_tree_build_threaded(tree, xs, n, prec);
+    _acb_poly_evaluate_vec_fast_precomp_multi(ys, ptrs, lens, num, tree, n, prec);
+    _acb_poly_tree_free(tree, n);
+
+    flint_free(ptrs);
+    flint_free(lens);
+}
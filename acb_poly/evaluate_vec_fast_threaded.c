@@ -0,0 +1,190 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "acb_poly.h"
+
+static __inline__ void
+_acb_poly_rem_2(acb_ptr r, acb_srcptr a, slong al,
+    acb_srcptr b, slong bl, slong prec)
+{
+    if (al == 2)
+    {
+        acb_mul(r + 0, a + 1, b + 0, prec);
+        acb_sub(r + 0, a + 0, r + 0, prec);
+    }
+    else
+    {
+        _acb_poly_rem(r, a, al, b, bl, prec);
+    }
+}
+
+typedef struct
+{
+    acb_ptr pc;
+    acb_srcptr pb;
+    acb_srcptr pa;
+    slong pblen;
+    slong pow;
+    slong len;
+    slong b0;
+    slong b1;
+    slong prec;
+}
+rem_arg_t;
+
+/* initial reduction: pc[i*pow : (i+1)*pow] = pb mod (chunk i of pa) */
+static void *
+rem_initial_worker(void * arg_ptr)
+{
+    rem_arg_t arg = *((rem_arg_t *) arg_ptr);
+    slong b, i, tlen, pow;
+
+    pow = arg.pow;
+
+    for (b = arg.b0; b < arg.b1; b++)
+    {
+        i = b * pow;
+        tlen = ((i + pow) <= arg.len) ? pow : arg.len % pow;
+        _acb_poly_rem(arg.pc + i, arg.pb, arg.pblen,
+            arg.pa + b * (pow + 1), tlen + 1, arg.prec);
+    }
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* one level of the descent, over complete blocks of length 2*pow */
+static void *
+rem_level_worker(void * arg_ptr)
+{
+    rem_arg_t arg = *((rem_arg_t *) arg_ptr);
+    slong b, pow;
+    acb_srcptr pa, pb;
+    acb_ptr pc;
+
+    pow = arg.pow;
+
+    for (b = arg.b0; b < arg.b1; b++)
+    {
+        pa = arg.pa + b * (2 * pow + 2);
+        pb = arg.pb + b * (2 * pow);
+        pc = arg.pc + b * (2 * pow);
+
+        _acb_poly_rem_2(pc, pb, 2 * pow, pa, pow + 1, arg.prec);
+        _acb_poly_rem_2(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, arg.prec);
+    }
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_acb_poly_evaluate_vec_fast_precomp_threaded(acb_ptr vs, acb_srcptr poly,
+    slong plen, acb_ptr * tree, slong len, slong prec)
+{
+    slong height, i, j, pow, left, num_blocks, num_threads, nt;
+    slong tree_height;
+    acb_ptr t, u, swap, pa, pb, pc;
+    pthread_t * threads;
+    rem_arg_t * args;
+
+    num_threads = flint_get_num_threads();
+
+    if (len < 2 || plen < 2 || num_threads <= 1)
+    {
+        _acb_poly_evaluate_vec_fast_precomp(vs, poly, plen, tree, len, prec);
+        return;
+    }
+
+    t = _acb_vec_init(len);
+    u = _acb_vec_init(len);
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(rem_arg_t) * num_threads);
+
+    height = FLINT_BIT_COUNT(plen - 1) - 1;
+    tree_height = FLINT_CLOG2(len);
+    while (height >= tree_height)
+        height--;
+    pow = WORD(1) << height;
+
+    /* initial reduction */
+    num_blocks = (len + pow - 1) / pow;
+    nt = FLINT_MIN(num_threads, num_blocks);
+
+    for (j = 0; j < nt; j++)
+    {
+        args[j].pc = t;
+        args[j].pb = poly;
+        args[j].pa = tree[height];
+        args[j].pblen = plen;
+        args[j].pow = pow;
+        args[j].len = len;
+        args[j].b0 = (num_blocks * j) / nt;
+        args[j].b1 = (num_blocks * (j + 1)) / nt;
+        args[j].prec = prec;
+
+        pthread_create(&threads[j], NULL, rem_initial_worker, &args[j]);
+    }
+
+    for (j = 0; j < nt; j++)
+        pthread_join(threads[j], NULL);
+
+    for (i = height - 1; i >= 0; i--)
+    {
+        pow = WORD(1) << i;
+        num_blocks = len / (2 * pow);
+        left = len - num_blocks * (2 * pow);
+        nt = FLINT_MIN(num_threads, num_blocks);
+
+        for (j = 0; j < nt; j++)
+        {
+            args[j].pc = u;
+            args[j].pb = t;
+            args[j].pa = tree[i];
+            args[j].pblen = 0;
+            args[j].pow = pow;
+            args[j].len = len;
+            args[j].b0 = (num_blocks * j) / nt;
+            args[j].b1 = (num_blocks * (j + 1)) / nt;
+            args[j].prec = prec;
+
+            pthread_create(&threads[j], NULL, rem_level_worker, &args[j]);
+        }
+
+        pa = tree[i] + num_blocks * (2 * pow + 2);
+        pb = t + num_blocks * (2 * pow);
+        pc = u + num_blocks * (2 * pow);
+
+        if (left > pow)
+        {
+            _acb_poly_rem(pc, pb, left, pa, pow + 1, prec);
+            _acb_poly_rem(pc + pow, pb, left, pa + pow + 1, left - pow + 1, prec);
+        }
+        else if (left > 0)
+            _acb_vec_set(pc, pb, left);
+
+        for (j = 0; j < nt; j++)
+            pthread_join(threads[j], NULL);
+
+        swap = t;
+        t = u;
+        u = swap;
+    }
+
+    _acb_vec_set(vs, t, len);
+    _acb_vec_clear(t, len);
+    _acb_vec_clear(u, len);
+
+    flint_free(threads);
+    flint_free(args);
+}
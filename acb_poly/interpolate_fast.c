@@ -35,7 +35,11 @@ _acb_poly_interpolation_weights(acb_ptr w,
                         tree[height-1] + (n + 1), (len - n + 1), prec);
 
     _acb_poly_derivative(tmp, tmp, len + 1, prec);
-    _acb_poly_evaluate_vec_fast_precomp(w, tmp, len, tree, len, prec);
+
+    if (flint_get_num_threads() > 1 && len >= 64 && (double) len * prec >= 16384)
+        _acb_poly_evaluate_vec_fast_precomp_threaded(w, tmp, len, tree, len, prec);
+    else
+        _acb_poly_evaluate_vec_fast_precomp(w, tmp, len, tree, len, prec);
 
     for (i = 0; i < len; i++)
         acb_inv(w + i, w + i, prec);
@@ -96,14 +100,25 @@ _acb_poly_interpolate_fast(acb_ptr poly,
 {
     acb_ptr * tree;
     acb_ptr w;
+    int threaded;
+
+    threaded = flint_get_num_threads() > 1 && len >= 64 &&
+        (double) len * prec >= 16384;
 
     tree = _acb_poly_tree_alloc(len);
-    _acb_poly_tree_build(tree, xs, len, prec);
+
+    if (threaded)
+        _acb_poly_tree_build_threaded(tree, xs, len, prec);
+    else
+        _acb_poly_tree_build(tree, xs, len, prec);
 
     w = _acb_vec_init(len);
     _acb_poly_interpolation_weights(w, tree, len, prec);
 
-    _acb_poly_interpolate_fast_precomp(poly, ys, tree, w, len, prec);
+    if (threaded)
+        _acb_poly_interpolate_fast_precomp_threaded(poly, ys, tree, w, len, prec);
+    else
+        _acb_poly_interpolate_fast_precomp(poly, ys, tree, w, len, prec);
 
     _acb_vec_clear(w, len);
     _acb_poly_tree_free(tree, len);
@@ -11,14 +11,26 @@
 
 #include "acb_poly.h"
 
+/* Algorithm crossovers. The Horner cutoff is the historical default;
+   the threaded cutoff is a conservative guess. Both can be adjusted to
+   measurements on the host (see acb_poly/profile/p-taylor_shift.c). */
+ARB_DLL slong acb_poly_taylor_shift_horner_cutoff = 30;
+ARB_DLL slong acb_poly_taylor_shift_threaded_cutoff = 1000;
+
 void
 _acb_poly_taylor_shift(acb_ptr poly, const acb_t c, slong n, slong prec)
 {
-    if (n <= 30 || (n <= 500 && acb_bits(c) == 1 && n < 30 + 3 * sqrt(prec))
-                || (n <= 100 && acb_bits(c) < 0.01 * prec))
+    slong cutoff = acb_poly_taylor_shift_horner_cutoff;
+
+    if (n <= cutoff || (n <= 500 && acb_bits(c) == 1 && n < cutoff + 3 * sqrt(prec))
+                    || (n <= 100 && acb_bits(c) < 0.01 * prec))
     {
         _acb_poly_taylor_shift_horner(poly, c, n, prec);
     }
+    else if (n >= acb_poly_taylor_shift_threaded_cutoff && flint_get_num_threads() > 1)
+    {
+        _acb_poly_taylor_shift_threaded(poly, c, n, prec);
+    }
     else if (prec > 2 * n)
     {
         _acb_poly_taylor_shift_convolution(poly, c, n, prec);
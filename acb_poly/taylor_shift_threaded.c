@@ -0,0 +1,139 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "acb_poly.h"
+
+typedef struct
+{
+    acb_ptr poly;
+    acb_srcptr c;
+    slong len;
+    slong prec;
+    slong num_threads;
+}
+taylor_shift_arg_t;
+
+static void
+_acb_poly_taylor_shift_leaf(acb_ptr poly, const acb_t c, slong len, slong prec)
+{
+    if (len <= acb_poly_taylor_shift_horner_cutoff)
+        _acb_poly_taylor_shift_horner(poly, c, len, prec);
+    else if (prec > 2 * len)
+        _acb_poly_taylor_shift_convolution(poly, c, len, prec);
+    else
+        _acb_poly_taylor_shift_divconquer(poly, c, len, prec);
+}
+
+/* res = (x+c)^m */
+static void
+_acb_poly_binomial_power(acb_ptr res, const acb_t c, slong m, slong prec)
+{
+    fmpz_t b;
+    slong k;
+
+    _acb_vec_set_powers(res, c, m + 1, prec);
+    _acb_poly_reverse(res, res, m + 1, m + 1);
+
+    fmpz_init(b);
+    fmpz_one(b);
+
+    for (k = 1; k < m; k++)
+    {
+        fmpz_mul_ui(b, b, m - k + 1);
+        fmpz_divexact_ui(b, b, k);
+        acb_mul_fmpz(res + k, res + k, b, prec);
+    }
+
+    fmpz_clear(b);
+}
+
+static void _acb_poly_taylor_shift_rec(acb_ptr poly, const acb_t c,
+    slong len, slong prec, slong num_threads);
+
+static void *
+taylor_shift_worker(void * arg_ptr)
+{
+    taylor_shift_arg_t arg = *((taylor_shift_arg_t *) arg_ptr);
+    _acb_poly_taylor_shift_rec(arg.poly, arg.c, arg.len, arg.prec,
+        arg.num_threads);
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Writing f = f_0 + x^m f_1, we have
+    f(x+c) = f_0(x+c) + (x+c)^m f_1(x+c). The two shifts are done in
+    parallel (recursively, splitting the available threads), and the
+    calling thread computes (x+c)^m while waiting for f_1(x+c).
+*/
+static void
+_acb_poly_taylor_shift_rec(acb_ptr poly, const acb_t c,
+    slong len, slong prec, slong num_threads)
+{
+    taylor_shift_arg_t arg;
+    pthread_t thread;
+    acb_ptr t, u;
+    slong i, m;
+
+    if (num_threads <= 1 || len <= 64)
+    {
+        _acb_poly_taylor_shift_leaf(poly, c, len, prec);
+        return;
+    }
+
+    m = len / 2;
+
+    arg.poly = poly + m;
+    arg.c = c;
+    arg.len = len - m;
+    arg.prec = prec;
+    arg.num_threads = num_threads - num_threads / 2;
+
+    pthread_create(&thread, NULL, taylor_shift_worker, &arg);
+
+    _acb_poly_taylor_shift_rec(poly, c, m, prec, num_threads / 2);
+
+    t = _acb_vec_init(len);
+    u = _acb_vec_init(m + 1);
+
+    _acb_poly_binomial_power(u, c, m, prec);
+
+    pthread_join(thread, NULL);
+
+    /* m + 1 >= len - m */
+    _acb_poly_mul(t, u, m + 1, poly + m, len - m, prec);
+    _acb_vec_add(t, t, poly, m, prec);
+    for (i = 0; i < len; i++)
+        acb_swap(poly + i, t + i);
+
+    _acb_vec_clear(t, len);
+    _acb_vec_clear(u, m + 1);
+}
+
+void
+_acb_poly_taylor_shift_threaded(acb_ptr poly, const acb_t c, slong n, slong prec)
+{
+    if (n <= 1 || acb_is_zero(c))
+        return;
+
+    _acb_poly_taylor_shift_rec(poly, c, n, prec, flint_get_num_threads());
+}
+
+void
+acb_poly_taylor_shift_threaded(acb_poly_t g, const acb_poly_t f,
+    const acb_t c, slong prec)
+{
+    if (f != g)
+        acb_poly_set_round(g, f, prec);
+
+    _acb_poly_taylor_shift_threaded(g->coeffs, c, g->length, prec);
+}
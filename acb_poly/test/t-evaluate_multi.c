@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("evaluate_multi....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 5000 * arb_test_multiplier(); iter++)
+    {
+        acb_poly_struct * f;
+        acb_ptr y1;
+        acb_t x, y2;
+        slong k, num, prec;
+
+        num = n_randint(state, 8);
+        prec = 2 + n_randint(state, 1000);
+
+        f = flint_malloc(sizeof(acb_poly_struct) * num);
+        y1 = _acb_vec_init(num);
+        acb_init(x);
+        acb_init(y2);
+
+        for (k = 0; k < num; k++)
+        {
+            acb_poly_init(f + k);
+            acb_poly_randtest(f + k, state, n_randint(state, 100),
+                2 + n_randint(state, 1000), 5);
+        }
+
+        acb_randtest(x, state, 2 + n_randint(state, 1000), 5);
+
+        acb_poly_evaluate_multi(y1, f, num, x, prec);
+
+        for (k = 0; k < num; k++)
+        {
+            acb_poly_evaluate_horner(y2, f + k, x, 2 + n_randint(state, 1000));
+
+            if (!acb_overlaps(y1 + k, y2))
+            {
+                flint_printf("FAIL (%wd of %wd)\n\n", k, num);
+                flint_printf("f = "); acb_poly_printd(f + k, 15); flint_printf("\n\n");
+                flint_printf("x = "); acb_printd(x, 15); flint_printf("\n\n");
+                flint_printf("y1 = "); acb_printd(y1 + k, 15); flint_printf("\n\n");
+                flint_printf("y2 = "); acb_printd(y2, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        for (k = 0; k < num; k++)
+            acb_poly_clear(f + k);
+        flint_free(f);
+        _acb_vec_clear(y1, num);
+        acb_clear(x);
+        acb_clear(y2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
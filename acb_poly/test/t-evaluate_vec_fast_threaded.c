@@ -0,0 +1,115 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_poly.h"
+
+static int
+vec_equal(acb_srcptr a, acb_srcptr b, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        if (!acb_equal(a + i, b + i))
+            return 0;
+
+    return 1;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("evaluate_vec_fast_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
+    {
+        slong i, n, plen, prec;
+        acb_ptr * tree1, * tree2;
+        acb_ptr x, y1, y2, w, p1, p2;
+        acb_poly_t f;
+
+        flint_set_num_threads(1 + n_randint(state, 5));
+
+        n = n_randint(state, 40);
+        plen = n_randint(state, 60);
+        prec = 2 + n_randint(state, 200);
+
+        acb_poly_init(f);
+        x = _acb_vec_init(n);
+        y1 = _acb_vec_init(n);
+        y2 = _acb_vec_init(n);
+        w = _acb_vec_init(n);
+        p1 = _acb_vec_init(n);
+        p2 = _acb_vec_init(n);
+
+        acb_poly_randtest(f, state, plen, 1 + n_randint(state, 200), 10);
+        for (i = 0; i < n; i++)
+            acb_randtest(x + i, state, 1 + n_randint(state, 200), 10);
+
+        tree1 = _acb_poly_tree_alloc(n);
+        tree2 = _acb_poly_tree_alloc(n);
+
+        _acb_poly_tree_build(tree1, x, n, prec);
+        _acb_poly_tree_build_threaded(tree2, x, n, prec);
+
+        for (i = 0; n != 0 && i <= FLINT_CLOG2(n); i++)
+        {
+            if (!vec_equal(tree1[i], tree2[i], n + (n >> i) + 1))
+            {
+                flint_printf("FAIL (tree, level %wd)\n\n", i);
+                flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+                flint_abort();
+            }
+        }
+
+        _acb_poly_evaluate_vec_fast_precomp(y1, f->coeffs, f->length, tree1, n, prec);
+        _acb_poly_evaluate_vec_fast_precomp_threaded(y2, f->coeffs, f->length, tree2, n, prec);
+
+        if (!vec_equal(y1, y2, n))
+        {
+            flint_printf("FAIL (evaluation)\n\n");
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_printf("f = "); acb_poly_printd(f, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        _acb_poly_interpolation_weights(w, tree1, n, prec);
+        _acb_poly_interpolate_fast_precomp(p1, y1, tree1, w, n, prec);
+        _acb_poly_interpolate_fast_precomp_threaded(p2, y1, tree2, w, n, prec);
+
+        if (!vec_equal(p1, p2, n))
+        {
+            flint_printf("FAIL (interpolation)\n\n");
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_abort();
+        }
+
+        _acb_poly_tree_free(tree1, n);
+        _acb_poly_tree_free(tree2, n);
+
+        acb_poly_clear(f);
+        _acb_vec_clear(x, n);
+        _acb_vec_clear(y1, n);
+        _acb_vec_clear(y2, n);
+        _acb_vec_clear(w, n);
+        _acb_vec_clear(p1, n);
+        _acb_vec_clear(p2, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "acb_poly.h"
+
+typedef struct
+{
+    acb_ptr pb;
+    acb_srcptr pa;
+    slong pow;
+    slong b0;
+    slong b1;
+    slong prec;
+}
+tree_build_arg_t;
+
+static void *
+tree_build_worker(void * arg_ptr)
+{
+    tree_build_arg_t arg = *((tree_build_arg_t *) arg_ptr);
+    slong b, pow;
+
+    pow = arg.pow;
+
+    for (b = arg.b0; b < arg.b1; b++)
+    {
+        _acb_poly_mul_monic(arg.pb + b * (2 * pow + 1),
+            arg.pa + b * (2 * pow + 2), pow + 1,
+            arg.pa + b * (2 * pow + 2) + pow + 1, pow + 1, arg.prec);
+    }
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_acb_poly_tree_build_threaded(acb_ptr * tree, acb_srcptr roots,
+    slong len, slong prec)
+{
+    slong height, pow, left, i, j, num_blocks, num_threads, nt;
+    pthread_t * threads;
+    tree_build_arg_t * args;
+    acb_ptr pa, pb;
+
+    if (len == 0)
+        return;
+
+    height = FLINT_CLOG2(len);
+    num_threads = flint_get_num_threads();
+
+    if (num_threads <= 1 || height <= 2)
+    {
+        _acb_poly_tree_build(tree, roots, len, prec);
+        return;
+    }
+
+    /* zeroth level, (x-a) */
+    for (i = 0; i < len; i++)
+    {
+        acb_one(tree[0] + (2 * i + 1));
+        acb_neg(tree[0] + (2 * i), roots + i);
+    }
+
+    /* first level, (x-a)(x-b) = x^2 + (-a-b)*x + a*b */
+    pa = tree[1];
+
+    for (i = 0; i < len / 2; i++)
+    {
+        acb_mul(pa + (3 * i), roots + (2 * i), roots + (2 * i + 1), prec);
+        acb_add(pa + (3 * i + 1), roots + (2 * i), roots + (2 * i + 1), prec);
+        acb_neg(pa + (3 * i + 1), pa + (3 * i + 1));
+        acb_one(pa + (3 * i + 2));
+    }
+
+    if (len & 1)
+    {
+        acb_neg(pa + (3 * (len / 2)), roots + len - 1);
+        acb_one(pa + (3 * (len / 2) + 1));
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(tree_build_arg_t) * num_threads);
+
+    /* the products on each level are independent; the last (incomplete)
+       block of a level is handled by the calling thread */
+    for (i = 1; i < height - 1; i++)
+    {
+        pow = WORD(1) << i;
+        num_blocks = len / (2 * pow);
+        left = len - num_blocks * (2 * pow);
+        nt = FLINT_MIN(num_threads, num_blocks);
+
+        for (j = 0; j < nt; j++)
+        {
+            args[j].pb = tree[i + 1];
+            args[j].pa = tree[i];
+            args[j].pow = pow;
+            args[j].b0 = (num_blocks * j) / nt;
+            args[j].b1 = (num_blocks * (j + 1)) / nt;
+            args[j].prec = prec;
+
+            pthread_create(&threads[j], NULL, tree_build_worker, &args[j]);
+        }
+
+        pa = tree[i] + num_blocks * (2 * pow + 2);
+        pb = tree[i + 1] + num_blocks * (2 * pow + 1);
+
+        if (left > pow)
+            _acb_poly_mul_monic(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, prec);
+        else if (left > 0)
+            _acb_vec_set(pb, pa, left + 1);
+
+        for (j = 0; j < nt; j++)
+            pthread_join(threads[j], NULL);
+    }
+
+    flint_free(threads);
+    flint_free(args);
+}
@@ -52,7 +52,7 @@ _acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulon
 
     /* sum 1/(k+a)^(s+x) */
     if (acb_is_one(a) && d <= 2 && _acb_vec_estimate_allocated_bytes(d * N / 6, prec) < SIEVE_ALLOC_LIMIT)
-        acb_dirichlet_powsum_sieved(sum, s, N, d, prec);
+        acb_dirichlet_powsum_sieved_threaded(sum, s, N, d, prec);
     else if (acb_is_one(a) && d <= 4) /* todo: also better for slightly larger d, if N and prec large enough */
         acb_dirichlet_powsum_smooth(sum, s, N, d, prec);
     else if (N > 50 && flint_get_num_threads() > 1)
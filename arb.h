@@ -536,6 +536,9 @@ void arb_gamma(arb_t z, const arb_t x, slong prec);
 void arb_gamma_fmpq(arb_t z, const fmpq_t x, slong prec);
 void arb_gamma_fmpz(arb_t z, const fmpz_t x, slong prec);
 void arb_digamma(arb_t y, const arb_t x, slong prec);
+
+ARB_DLL extern slong arb_gamma_lowprec_cutoff;
+
 void arb_zeta(arb_t z, const arb_t s, slong prec);
 void arb_hurwitz_zeta(arb_t z, const arb_t s, const arb_t a, slong prec);
 
@@ -17,6 +17,8 @@ void arb_gamma_stirling_choose_param(int * reflect, slong * r, slong * n,
 
 void arb_gamma_stirling_eval(arb_t s, const arb_t z, slong nterms, int digamma, slong prec);
 
+int _arb_gamma_lowprec(arb_t y, const arb_t x, int kind, slong prec);
+
 void
 arb_digamma(arb_t y, const arb_t x, slong prec)
 {
@@ -61,6 +63,9 @@ arb_digamma(arb_t y, const arb_t x, slong prec)
         }
     }
 
+    if (_arb_gamma_lowprec(y, x, 3, prec))
+        return;
+
     wp = prec + FLINT_BIT_COUNT(prec);
 
     arb_gamma_stirling_choose_param(&reflect, &r, &n, x, 1, 1, wp);
@@ -17,6 +17,8 @@
 /* tuning factor */
 #define GAMMA_STIRLING_BETA 0.27
 
+int _arb_gamma_lowprec(arb_t y, const arb_t x, int kind, slong prec);
+
 #define PI 3.1415926535897932385
 
 static slong
@@ -800,6 +802,9 @@ _arb_gamma(arb_t y, const arb_t x, slong prec, int inverse)
         }
     }
 
+    if (_arb_gamma_lowprec(y, x, inverse, prec))
+        return;
+
     /* todo: for large x (if exact or accurate enough), increase precision */
     acc = arb_rel_accuracy_bits(x);
     acc = FLINT_MAX(acc, 0);
@@ -930,6 +935,9 @@ arb_lgamma(arb_t y, const arb_t x, slong prec)
         return;
     }
 
+    if (_arb_gamma_lowprec(y, x, 2, prec))
+        return;
+
     wp = prec + FLINT_BIT_COUNT(prec);
 
     arb_gamma_stirling_choose_param(&reflect, &r, &n, x, 0, 0, wp);
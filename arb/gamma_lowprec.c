@@ -0,0 +1,244 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+
+void arb_gamma_stirling_coeff(arb_t b, ulong k, int digamma, slong prec);
+
+ARB_DLL slong arb_gamma_lowprec_cutoff = 128;
+
+/* precision of the cached Stirling coefficients; the fast path
+   is only used when the working precision is below this */
+#define LOWPREC_COEFF_PREC 192
+#define LOWPREC_NUM_COEFFS 48
+
+/* same tuning factor as in gamma.c */
+#define GAMMA_STIRLING_BETA 0.27
+
+TLS_PREFIX int _arb_gamma_lowprec_cached = 0;
+TLS_PREFIX arb_struct _arb_gamma_lowprec_coeffs[2][LOWPREC_NUM_COEFFS];
+TLS_PREFIX double _arb_gamma_lowprec_log2[2][LOWPREC_NUM_COEFFS];
+
+static void
+_arb_gamma_lowprec_cleanup(void)
+{
+    slong k;
+
+    for (k = 0; k < LOWPREC_NUM_COEFFS; k++)
+    {
+        arb_clear(_arb_gamma_lowprec_coeffs[0] + k);
+        arb_clear(_arb_gamma_lowprec_coeffs[1] + k);
+    }
+
+    _arb_gamma_lowprec_cached = 0;
+}
+
+/*
+    Entry k of the first table is B_{2k} / (2k (2k-1)), used for the
+    Stirling series of log(gamma(z)); entry k of the second table is
+    B_{2k} / (2k), used for the Stirling series of digamma(z).
+    Entry 0 is unused. Also stores approximate base-2 logarithms of the
+    magnitudes for choosing the number of terms.
+*/
+static void
+_arb_gamma_lowprec_init(void)
+{
+    slong k;
+    int j;
+
+    for (j = 0; j < 2; j++)
+    {
+        for (k = 0; k < LOWPREC_NUM_COEFFS; k++)
+        {
+            arb_init(_arb_gamma_lowprec_coeffs[j] + k);
+
+            if (k == 0)
+            {
+                _arb_gamma_lowprec_log2[j][k] = 0.0;
+            }
+            else
+            {
+                arb_gamma_stirling_coeff(_arb_gamma_lowprec_coeffs[j] + k,
+                    k, j, LOWPREC_COEFF_PREC);
+                _arb_gamma_lowprec_log2[j][k] = log(fabs(arf_get_d(arb_midref(
+                    _arb_gamma_lowprec_coeffs[j] + k), ARF_RND_UP))) * 1.44269504088896341;
+            }
+        }
+    }
+
+    flint_register_cleanup_function(_arb_gamma_lowprec_cleanup);
+    _arb_gamma_lowprec_cached = 1;
+}
+
+/*
+    Computes gamma(x) (kind = 0), 1/gamma(x) (kind = 1), log(gamma(x))
+    (kind = 2) or digamma(x) (kind = 3) for x > 0 at low precision using
+    a Stirling series with cached coefficients. The reduction parameters
+    are chosen in double arithmetic and the truncation error is bounded
+    by the first omitted term, which is valid for real z > 0.
+    Returns 0 without touching y if the fast path does not apply.
+*/
+int
+_arb_gamma_lowprec(arb_t y, const arb_t x, int kind, slong prec)
+{
+    slong k, n, r, wp;
+    double xd, zd, w, log2z, term;
+    int digamma;
+    const arb_struct * c;
+    const double * log2c;
+    arb_t z, zinv, zinv2, s, t, u;
+    mag_t err, m;
+
+    if (prec > arb_gamma_lowprec_cutoff)
+        return 0;
+
+    wp = prec + 2 * FLINT_BIT_COUNT(prec);
+
+    if (wp > LOWPREC_COEFF_PREC - 16)
+        return 0;
+
+    if (!arb_is_finite(x) || !arb_is_positive(x))
+        return 0;
+
+    if (arf_cmpabs_2exp_si(arb_midref(x), 40) >= 0)
+        return 0;
+
+    digamma = (kind == 3);
+
+    /* argument reduction until z = x + r >= w */
+    xd = arf_get_d(arb_midref(x), ARF_RND_DOWN);
+    w = FLINT_MAX(1.0, GAMMA_STIRLING_BETA * wp);
+    r = (xd >= w) ? 0 : (slong) (w - xd) + 1;
+    zd = xd + r;
+    log2z = log(zd) * 1.44269504088896341;
+
+    if (!_arb_gamma_lowprec_cached)
+        _arb_gamma_lowprec_init();
+
+    c = _arb_gamma_lowprec_coeffs[digamma];
+    log2c = _arb_gamma_lowprec_log2[digamma];
+
+    for (n = 1; n < LOWPREC_NUM_COEFFS; n++)
+    {
+        term = log2c[n] - (2 * n - 1 + digamma) * log2z;
+        if (term <= -wp)
+            break;
+    }
+
+    if (n == LOWPREC_NUM_COEFFS)
+        return 0;
+
+    arb_init(z);
+    arb_init(zinv);
+    arb_init(zinv2);
+    arb_init(s);
+    arb_init(t);
+    arb_init(u);
+    mag_init(err);
+    mag_init(m);
+
+    arb_add_ui(z, x, r, wp);
+    arb_inv(zinv, z, wp);
+    arb_mul(zinv2, zinv, zinv, wp);
+
+    /* s = sum_{k=1}^{n-1} c_k / z^(2k-1)  (or c_k / z^(2k) for digamma) */
+    arb_zero(s);
+    for (k = n - 1; k >= 1; k--)
+    {
+        arb_mul(s, s, zinv2, wp);
+        arb_add(s, s, c + k, wp);
+    }
+
+    if (digamma)
+        arb_mul(s, s, zinv2, wp);
+    else
+        arb_mul(s, s, zinv, wp);
+
+    /* the remainder is bounded by the first omitted term */
+    arb_get_mag_lower(m, z);
+    mag_inv(m, m);
+    mag_pow_ui(m, m, 2 * n - 1 + digamma);
+    arb_get_mag(err, c + n);
+    mag_mul(err, err, m);
+    mag_add(arb_radref(s), arb_radref(s), err);
+
+    arb_log(t, z, wp);
+
+    if (digamma)
+    {
+        /* psi(z) = log(z) - 1/(2z) - s */
+        arb_sub(s, t, s, wp);
+        arb_mul_2exp_si(zinv, zinv, -1);
+        arb_sub(s, s, zinv, wp);
+
+        /* psi(x) = psi(x+r) - sum_{i=0}^{r-1} 1/(x+i) */
+        if (r == 0)
+        {
+            arb_set_round(y, s, prec);
+        }
+        else
+        {
+            arb_rising2_ui(t, u, x, r, wp);
+            arb_div(u, u, t, wp);
+            arb_sub(y, s, u, prec);
+        }
+    }
+    else
+    {
+        /* log(gamma(z)) = (z-1/2) log(z) - z + log(2 pi)/2 + s */
+        arb_one(u);
+        arb_mul_2exp_si(u, u, -1);
+        arb_sub(u, z, u, wp);
+        arb_mul(t, t, u, wp);
+        arb_add(s, s, t, wp);
+        arb_sub(s, s, z, wp);
+        arb_const_log_sqrt2pi(t, wp);
+        arb_add(s, s, t, wp);
+
+        /* rf(x, r) */
+        arb_one(u);
+        arb_set(t, x);
+        for (k = 0; k < r; k++)
+        {
+            arb_mul(u, u, t, wp);
+            arb_add_ui(t, t, 1, wp);
+        }
+
+        if (kind == 0)
+        {
+            arb_exp(s, s, wp);
+            arb_div(y, s, u, prec);
+        }
+        else if (kind == 1)
+        {
+            arb_neg(s, s);
+            arb_exp(s, s, wp);
+            arb_mul(y, s, u, prec);
+        }
+        else
+        {
+            arb_log(u, u, wp);
+            arb_sub(y, s, u, prec);
+        }
+    }
+
+    arb_clear(z);
+    arb_clear(zinv);
+    arb_clear(zinv2);
+    arb_clear(s);
+    arb_clear(t);
+    arb_clear(u);
+    mag_clear(err);
+    mag_clear(m);
+
+    return 1;
+}
+
@@ -0,0 +1,111 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "arb.h"
+#include "acb.h"
+#include "flint/profiler.h"
+
+/*
+    Compares the low-precision code path for arb_gamma, arb_lgamma and
+    arb_digamma against the general code (arb_gamma_lowprec_cutoff = 0)
+    on random positive arguments. The acb_gamma row times acb_gamma on
+    the same real arguments, which dispatches to arb_gamma.
+
+    usage: p-gamma_lowprec [num_points]
+*/
+
+typedef void (*gamma_func_t)(arb_t, const arb_t, slong);
+
+static void
+_acb_gamma_real(arb_t y, const arb_t x, slong prec)
+{
+    acb_t t;
+
+    acb_init(t);
+    acb_set_arb(t, x);
+    acb_gamma(t, t, prec);
+    arb_swap(y, acb_realref(t));
+    acb_clear(t);
+}
+
+static double
+time_func(gamma_func_t func, arb_srcptr x, slong num, slong prec)
+{
+    timeit_t timer;
+    arb_t y;
+    slong i;
+
+    arb_init(y);
+
+    timeit_start(timer);
+    for (i = 0; i < num; i++)
+        func(y, x + i, prec);
+    timeit_stop(timer);
+
+    arb_clear(y);
+
+    return (double) timer->wall;
+}
+
+int main(int argc, char *argv[])
+{
+    slong prec_tab[5] = { 32, 53, 64, 96, 128 };
+    const char * names[4] = { "gamma", "lgamma", "digamma", "acb_gamma" };
+    gamma_func_t func[4] = { arb_gamma, arb_lgamma, arb_digamma, _acb_gamma_real };
+    slong i, j, k, num, prec, cutoff;
+    double t_fast, t_general;
+    flint_rand_t state;
+    arb_ptr x;
+
+    num = (argc > 1) ? atol(argv[1]) : 100000;
+
+    flint_randinit(state);
+    x = _arb_vec_init(num);
+
+    /* x uniformly distributed in (0, 100) with 53-bit midpoints */
+    for (i = 0; i < num; i++)
+    {
+        arb_set_ui(x + i, 1 + n_randint(state, UWORD(1) << 30));
+        arb_mul_2exp_si(x + i, x + i, -30);
+        arb_mul_ui(x + i, x + i, 100, 53);
+    }
+
+    cutoff = arb_gamma_lowprec_cutoff;
+
+    flint_printf("%10s %8s %12s %12s %8s\n", "func", "prec",
+        "general", "lowprec", "speedup");
+
+    for (k = 0; k < 4; k++)
+    {
+        for (j = 0; j < 5; j++)
+        {
+            prec = prec_tab[j];
+
+            /* warm up caches */
+            time_func(func[k], x, FLINT_MIN(num, 100), prec);
+
+            arb_gamma_lowprec_cutoff = 0;
+            t_general = time_func(func[k], x, num, prec);
+            arb_gamma_lowprec_cutoff = cutoff;
+            t_fast = time_func(func[k], x, num, prec);
+
+            flint_printf("%10s %8wd %12g %12g %8.3f\n", names[k], prec,
+                t_general, t_fast, t_general / FLINT_MAX(t_fast, 1));
+        }
+    }
+
+    _arb_vec_clear(x, num);
+    flint_randclear(state);
+    flint_cleanup();
+    return EXIT_SUCCESS;
+}
+
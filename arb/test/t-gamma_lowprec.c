@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+
+typedef void (*gamma_func_t)(arb_t, const arb_t, slong);
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+    gamma_func_t func[4] = { arb_gamma, arb_rgamma, arb_lgamma, arb_digamma };
+
+    flint_printf("gamma_lowprec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000 * arb_test_multiplier(); iter++)
+    {
+        arb_t x, y1, y2;
+        slong prec1, prec2, cutoff;
+        int which;
+
+        arb_init(x);
+        arb_init(y1);
+        arb_init(y2);
+
+        which = n_randint(state, 4);
+        prec1 = 2 + n_randint(state, 150);
+        prec2 = 2 + n_randint(state, 150);
+
+        arb_randtest(x, state, 1 + n_randint(state, 150), 1 + n_randint(state, 8));
+
+        if (n_randint(state, 2))
+            arb_abs(x, x);
+
+        cutoff = arb_gamma_lowprec_cutoff;
+
+        func[which](y1, x, prec1);
+
+        arb_gamma_lowprec_cutoff = 0;
+        func[which](y2, x, prec2);
+        arb_gamma_lowprec_cutoff = cutoff;
+
+        if (!arb_overlaps(y1, y2))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("which = %d, prec1 = %wd, prec2 = %wd\n\n", which, prec1, prec2);
+            flint_printf("x = "); arb_printd(x, 30); flint_printf("\n\n");
+            flint_printf("y1 = "); arb_printd(y1, 30); flint_printf("\n\n");
+            flint_printf("y2 = "); arb_printd(y2, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* gamma has no zeros or poles for x > 0, so exact input
+           should give a nearly full-accuracy result */
+        if (which <= 1 && arb_is_exact(x) && arb_is_positive(x) &&
+            prec1 >= 16 && arf_cmpabs_2exp_si(arb_midref(x), 4) < 0 &&
+            arb_rel_accuracy_bits(y1) < prec1 - 6)
+        {
+            flint_printf("FAIL: accuracy\n\n");
+            flint_printf("which = %d, prec1 = %wd\n\n", which, prec1);
+            flint_printf("x = "); arb_printd(x, 30); flint_printf("\n\n");
+            flint_printf("y1 = "); arb_printd(y1, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arb_clear(x);
+        arb_clear(y1);
+        arb_clear(y2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -19,6 +19,17 @@
 extern "C" {
 #endif
 
+void arb_hypgeom_pfq_sum_forward(arb_t s, arb_t t, arb_srcptr a, slong p, arb_srcptr b, slong q,
+    const arb_t z, slong n, slong prec);
+void arb_hypgeom_pfq_sum_rs(arb_t s, arb_t t, arb_srcptr a, slong p, arb_srcptr b, slong q,
+    const arb_t z, slong n, slong prec);
+void arb_hypgeom_pfq_sum_bs(arb_t s, arb_t t, arb_srcptr a, slong p, arb_srcptr b, slong q,
+    const arb_t z, slong n, slong prec);
+void arb_hypgeom_pfq_sum(arb_t s, arb_t t, arb_srcptr a, slong p, arb_srcptr b, slong q,
+    const arb_t z, slong n, slong prec);
+void arb_hypgeom_pfq_direct(arb_t res, arb_srcptr a, slong p, arb_srcptr b, slong q,
+    const arb_t z, slong n, slong prec);
+
 void arb_hypgeom_pfq(arb_t res, arb_srcptr a, slong p, arb_srcptr b, slong q,
     const arb_t z, int regularized, slong prec);
 
@@ -77,6 +88,13 @@ void arb_hypgeom_bessel_k(arb_t res, const arb_t nu, const arb_t z, slong prec);
 void arb_hypgeom_bessel_i_scaled(arb_t res, const arb_t nu, const arb_t z, slong prec);
 void arb_hypgeom_bessel_k_scaled(arb_t res, const arb_t nu, const arb_t z, slong prec);
 
+void arb_hypgeom_bessel_j_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec);
+void arb_hypgeom_bessel_y_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec);
+void arb_hypgeom_bessel_i_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec);
+void arb_hypgeom_bessel_i_scaled_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec);
+void arb_hypgeom_bessel_k_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec);
+void arb_hypgeom_bessel_k_scaled_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec);
+
 void arb_hypgeom_airy(arb_t ai, arb_t aip, arb_t bi, arb_t bip, const arb_t z, slong prec);
 void arb_hypgeom_airy_jet(arb_ptr ai, arb_ptr bi, const arb_t z, slong len, slong prec);
 void arb_hypgeom_airy_series(arb_poly_t ai, arb_poly_t ai_prime,
@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+#include "acb_hypgeom.h"
+
+static void
+_arb_hypgeom_0f1_direct(arb_t res, const arb_t a, const arb_t z, int regularized, slong prec)
+{
+    if (regularized)
+    {
+        if (arb_is_int(a) && arf_sgn(arb_midref(a)) <= 0)
+        {
+            /* 0F1~(a, z) = z^(1-a) 0F1~(2-a, z) */
+            arb_t t, u;
+            fmpz_t e;
+
+            arb_init(t);
+            arb_init(u);
+            fmpz_init(e);
+
+            arf_get_fmpz(e, arb_midref(a), ARF_RND_DOWN);
+            fmpz_sub_ui(e, e, 1);
+            fmpz_neg(e, e);
+            arb_sub_ui(t, a, 2, prec);
+            arb_neg(t, t);
+            arb_pow_fmpz(u, z, e, prec);
+            /* this cannot recurse infinitely, because t is
+               an exact positive integer */
+            _arb_hypgeom_0f1_direct(res, t, z, regularized, prec);
+            arb_mul(res, res, u, prec);
+
+            arb_clear(t);
+            arb_clear(u);
+            fmpz_clear(e);
+        }
+        else
+        {
+            arb_t t;
+            arb_init(t);
+            arb_rgamma(t, a, prec);
+            _arb_hypgeom_0f1_direct(res, a, z, 0, prec);
+            arb_mul(res, res, t, prec);
+            arb_clear(t);
+        }
+    }
+    else
+    {
+        arb_struct b[2];
+        b[0] = *a;
+        arb_init(b + 1);
+        arb_one(b + 1);
+        arb_hypgeom_pfq_direct(res, NULL, 0, b, 2, z, -1, prec);
+        arb_clear(b + 1);
+    }
+}
+
+static int
+_arb_hypgeom_0f1_use_asymp(const arb_t z, slong prec)
+{
+    double x, c;
+
+    if (arf_cmpabs_2exp_si(arb_midref(z), 0) < 0)
+        return 0;
+
+    if (arf_cmpabs_2exp_si(arb_midref(z), 128) > 0)
+        return 1;
+
+    x = arf_get_d(arb_midref(z), ARF_RND_DOWN);
+
+    c = prec * 0.69314718055994530942;
+    c = c * c;
+    c = c * c;
+
+    return x * x > c;
+}
+
+void
+arb_hypgeom_0f1(arb_t res, const arb_t a, const arb_t z, int regularized, slong prec)
+{
+    if (!arb_is_finite(a) || !arb_is_finite(z))
+    {
+        arb_indeterminate(res);
+    }
+    else if (!_arb_hypgeom_0f1_use_asymp(z, prec))
+    {
+        _arb_hypgeom_0f1_direct(res, a, z, regularized, prec);
+    }
+    else
+    {
+        acb_t t, u;
+        acb_init(t);
+        acb_init(u);
+        arb_set(acb_realref(t), a);
+        arb_set(acb_realref(u), z);
+        acb_hypgeom_0f1(t, t, u, regularized, prec);
+        if (acb_is_finite(t) && acb_is_real(t))
+            arb_swap(res, acb_realref(t));
+        else
+            arb_indeterminate(res);
+        acb_clear(t);
+        acb_clear(u);
+    }
+}
+
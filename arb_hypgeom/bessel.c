@@ -0,0 +1,235 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+#include "acb_hypgeom.h"
+
+/* (z/2)^nu, real for integer nu or positive z */
+static void
+_arb_hypgeom_bessel_half_pow(arb_t res, const arb_t nu, const arb_t z, slong prec)
+{
+    arb_mul_2exp_si(res, z, -1);
+
+    if (arb_is_int(nu))
+    {
+        fmpz_t n;
+        fmpz_init(n);
+        arf_get_fmpz(n, arb_midref(nu), ARF_RND_DOWN);
+        arb_pow_fmpz(res, res, n, prec);
+        fmpz_clear(n);
+    }
+    else
+    {
+        arb_pow(res, res, nu, prec);
+    }
+}
+
+/* requires nu to be an integer or z to be positive */
+static void
+_arb_hypgeom_bessel_j_0f1(arb_t res, const arb_t nu, const arb_t z, slong prec)
+{
+    arb_struct b[2];
+    arb_t w, c, t;
+
+    if (arb_is_int(nu) && arb_is_negative(nu))
+    {
+        arb_init(t);
+        arb_neg(t, nu);
+
+        _arb_hypgeom_bessel_j_0f1(res, t, z, prec);
+
+        arb_mul_2exp_si(t, t, -1);
+        if (!arb_is_int(t))
+            arb_neg(res, res);
+
+        arb_clear(t);
+        return;
+    }
+
+    arb_init(b + 0);
+    arb_init(b + 1);
+    arb_init(w);
+    arb_init(c);
+    arb_init(t);
+
+    arb_add_ui(b + 0, nu, 1, prec);
+    arb_one(b + 1);
+
+    /* (z/2)^nu / gamma(nu+1) */
+    _arb_hypgeom_bessel_half_pow(c, nu, z, prec);
+    arb_rgamma(t, b + 0, prec);
+    arb_mul(c, t, c, prec);
+
+    /* -z^2/4 */
+    arb_mul(w, z, z, prec);
+    arb_mul_2exp_si(w, w, -2);
+    arb_neg(w, w);
+
+    arb_hypgeom_pfq_direct(t, NULL, 0, b, 2, w, -1, prec);
+
+    arb_mul(res, t, c, prec);
+
+    arb_clear(b + 0);
+    arb_clear(b + 1);
+    arb_clear(w);
+    arb_clear(c);
+    arb_clear(t);
+}
+
+/* requires nu to be an integer or z to be positive */
+static void
+_arb_hypgeom_bessel_i_0f1(arb_t res, const arb_t nu, const arb_t z, int scaled, slong prec)
+{
+    arb_struct b[2];
+    arb_t w, c, t;
+
+    if (arb_is_int(nu) && arb_is_negative(nu))
+    {
+        arb_init(t);
+        arb_neg(t, nu);
+        _arb_hypgeom_bessel_i_0f1(res, t, z, scaled, prec);
+        arb_clear(t);
+        return;
+    }
+
+    arb_init(b + 0);
+    arb_init(b + 1);
+    arb_init(w);
+    arb_init(c);
+    arb_init(t);
+
+    arb_add_ui(b + 0, nu, 1, prec);
+    arb_one(b + 1);
+
+    /* (z/2)^nu / gamma(nu+1) */
+    _arb_hypgeom_bessel_half_pow(c, nu, z, prec);
+    arb_rgamma(t, b + 0, prec);
+    arb_mul(c, t, c, prec);
+
+    /* z^2/4 */
+    arb_mul(w, z, z, prec);
+    arb_mul_2exp_si(w, w, -2);
+
+    arb_hypgeom_pfq_direct(t, NULL, 0, b, 2, w, -1, prec);
+
+    if (scaled)
+    {
+        arb_neg(w, z);
+        arb_exp(w, w, prec);
+        arb_mul(t, t, w, prec);
+    }
+
+    arb_mul(res, t, c, prec);
+
+    arb_clear(b + 0);
+    arb_clear(b + 1);
+    arb_clear(w);
+    arb_clear(c);
+    arb_clear(t);
+}
+
+/* same criterion as in acb_hypgeom_bessel_j and acb_hypgeom_bessel_i,
+   restricted to parameters where the result is real */
+static int
+_arb_hypgeom_bessel_use_0f1(const arb_t nu, const arb_t z, slong prec)
+{
+    mag_t zmag;
+    int result;
+
+    if (!arb_is_finite(nu) || !arb_is_finite(z))
+        return 0;
+
+    if (!arb_is_int(nu) && !arb_is_positive(z))
+        return 0;
+
+    mag_init(zmag);
+    arb_get_mag(zmag, z);
+
+    result = mag_cmp_2exp_si(zmag, 4) < 0 ||
+        (mag_cmp_2exp_si(zmag, 64) < 0 && 2 * mag_get_d(zmag) < prec);
+
+    mag_clear(zmag);
+
+    return result;
+}
+
+void
+arb_hypgeom_bessel_j(arb_t res, const arb_t nu, const arb_t z, slong prec)
+{
+    if (_arb_hypgeom_bessel_use_0f1(nu, z, prec))
+    {
+        _arb_hypgeom_bessel_j_0f1(res, nu, z, prec);
+    }
+    else
+    {
+        acb_t t, u;
+        acb_init(t);
+        acb_init(u);
+        arb_set(acb_realref(t), nu);
+        arb_set(acb_realref(u), z);
+        acb_hypgeom_bessel_j(t, t, u, prec);
+        if (acb_is_finite(t) && acb_is_real(t))
+            arb_swap(res, acb_realref(t));
+        else
+            arb_indeterminate(res);
+        acb_clear(t);
+        acb_clear(u);
+    }
+}
+
+void
+arb_hypgeom_bessel_i(arb_t res, const arb_t nu, const arb_t z, slong prec)
+{
+    if (_arb_hypgeom_bessel_use_0f1(nu, z, prec))
+    {
+        _arb_hypgeom_bessel_i_0f1(res, nu, z, 0, prec);
+    }
+    else
+    {
+        acb_t t, u;
+        acb_init(t);
+        acb_init(u);
+        arb_set(acb_realref(t), nu);
+        arb_set(acb_realref(u), z);
+        acb_hypgeom_bessel_i(t, t, u, prec);
+        if (acb_is_finite(t) && acb_is_real(t))
+            arb_swap(res, acb_realref(t));
+        else
+            arb_indeterminate(res);
+        acb_clear(t);
+        acb_clear(u);
+    }
+}
+
+void
+arb_hypgeom_bessel_i_scaled(arb_t res, const arb_t nu, const arb_t z, slong prec)
+{
+    if (_arb_hypgeom_bessel_use_0f1(nu, z, prec))
+    {
+        _arb_hypgeom_bessel_i_0f1(res, nu, z, 1, prec);
+    }
+    else
+    {
+        acb_t t, u;
+        acb_init(t);
+        acb_init(u);
+        arb_set(acb_realref(t), nu);
+        arb_set(acb_realref(u), z);
+        acb_hypgeom_bessel_i_scaled(t, t, u, prec);
+        if (acb_is_finite(t) && acb_is_real(t))
+            arb_swap(res, acb_realref(t));
+        else
+            arb_indeterminate(res);
+        acb_clear(t);
+        acb_clear(u);
+    }
+}
+
@@ -0,0 +1,220 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+typedef void (*bessel_func_t)(arb_t, const arb_t, const arb_t, slong);
+
+#define BESSEL_VEC_BLOCK 64
+
+/* number of k with 0 <= k < len and |nu + k| < r */
+static slong
+_bessel_vec_num_oscillatory(double nu, double r, slong len)
+{
+    double lo, hi;
+
+    if (!(r > 0.0) || nu != nu)
+        return 0;
+
+    r = FLINT_MIN(r, 1e15);
+    nu = FLINT_MAX(FLINT_MIN(nu, 1e15), -1e15);
+
+    lo = FLINT_MAX(ceil(-r - nu), 0.0);
+    hi = FLINT_MIN(floor(r - nu), (double) (len - 1));
+
+    if (hi < lo)
+        return 0;
+
+    return (slong) (hi - lo) + 1;
+}
+
+/*
+    Sets res[k] = C_{nu+k}(z) for lo <= k < hi, starting from two anchor
+    values computed with func and applying the three-term recurrence
+    forward from lo or backward from hi - 1.
+*/
+static void
+_arb_hypgeom_bessel_vec_block(arb_ptr res, const arb_t n, const arb_t x,
+    const arb_t w, slong lo, slong hi, bessel_func_t func, int sign,
+    int backward, slong wp)
+{
+    arb_t t;
+    slong k;
+
+    arb_init(t);
+
+    if (hi - lo <= 2)
+    {
+        for (k = lo; k < hi; k++)
+        {
+            arb_add_si(t, n, k, wp);
+            func(res + k, t, x, wp);
+        }
+    }
+    else if (backward)
+    {
+        arb_add_si(t, n, hi - 1, wp);
+        func(res + hi - 1, t, x, wp);
+        arb_add_si(t, n, hi - 2, wp);
+        func(res + hi - 2, t, x, wp);
+
+        for (k = hi - 2; k > lo; k--)
+        {
+            arb_add_si(t, n, k, wp);
+            arb_mul(t, t, w, wp);
+            arb_mul(t, t, res + k, wp);
+
+            if (sign == 1)
+                arb_sub(res + k - 1, t, res + k + 1, wp);
+            else
+                arb_add(res + k - 1, t, res + k + 1, wp);
+        }
+    }
+    else
+    {
+        arb_add_si(t, n, lo, wp);
+        func(res + lo, t, x, wp);
+        arb_add_si(t, n, lo + 1, wp);
+        func(res + lo + 1, t, x, wp);
+
+        for (k = lo + 1; k < hi - 1; k++)
+        {
+            arb_add_si(t, n, k, wp);
+            arb_mul(t, t, w, wp);
+            arb_mul(t, t, res + k, wp);
+
+            if (sign == 1)
+                arb_sub(res + k + 1, t, res + k - 1, wp);
+            else
+                arb_add(res + k + 1, t, res + k - 1, wp);
+        }
+    }
+
+    arb_clear(t);
+}
+
+/*
+    Sets res[k] = C_{nu+k}(z) for 0 <= k < len, where C is one of the
+    Bessel functions. With sign = 1, J and Y satisfy
+
+        C_{m-1} + C_{m+1} = (2m/z) C_m,
+
+    and with sign = -1, I and K (as well as the scaled versions) satisfy
+
+        I_{m-1} - I_{m+1} = (2m/z) I_m,   K_{m+1} - K_{m-1} = (2m/z) K_m.
+
+    Two anchor values are computed with func and the remaining values
+    are obtained by recurrence, running forward (stable for the
+    dominant solutions Y and K) or backward (stable for the minimal
+    solutions J and I). The recurrence is done in ball arithmetic, so
+    the output is always rigorous.
+
+    In the oscillatory region |m| < |z| of J and Y, the solutions do not
+    grow, but the radii can grow by a factor up to 1 + sqrt(2) (about
+    1.27 bits) per step. The recurrence is therefore restarted from new
+    anchor values every BESSEL_VEC_BLOCK orders, and the working
+    precision includes enough guard bits for the loss within one block.
+*/
+static void
+_arb_hypgeom_bessel_vec(arb_ptr res, const arb_t nu, const arb_t z,
+    slong len, bessel_func_t func, int sign, int backward, slong prec)
+{
+    arb_t n, x, w;
+    mag_t r;
+    slong k, wp, osc, block;
+
+    if (len <= 0)
+        return;
+
+    arb_init(n);
+    arb_init(x);
+    arb_init(w);
+    mag_init(r);
+
+    arb_set(n, nu);
+    arb_set(x, z);
+
+    if (len <= 2 || !arb_is_finite(x) || arb_contains_zero(x))
+    {
+        for (k = 0; k < len; k++)
+        {
+            arb_add_si(w, n, k, prec);
+            func(res + k, w, x, prec);
+        }
+    }
+    else
+    {
+        osc = 0;
+        if (sign == 1)
+        {
+            arb_get_mag(r, x);
+            osc = _bessel_vec_num_oscillatory(
+                arf_get_d(arb_midref(n), ARF_RND_NEAR), mag_get_d(r), len);
+        }
+
+        block = (osc > 0) ? BESSEL_VEC_BLOCK : len;
+
+        wp = prec + 2 * FLINT_BIT_COUNT(len) + 10;
+        wp += (slong) (1.28 * FLINT_MIN(osc, block)) + 1;
+
+        arb_inv(w, x, wp);
+        arb_mul_2exp_si(w, w, 1);
+
+        for (k = 0; k < len; k += block)
+            _arb_hypgeom_bessel_vec_block(res, n, x, w, k,
+                FLINT_MIN(k + block, len), func, sign, backward, wp);
+
+        for (k = 0; k < len; k++)
+            arb_set_round(res + k, res + k, prec);
+    }
+
+    arb_clear(n);
+    arb_clear(x);
+    arb_clear(w);
+    mag_clear(r);
+}
+
+void
+arb_hypgeom_bessel_j_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec)
+{
+    _arb_hypgeom_bessel_vec(res, nu, z, len, arb_hypgeom_bessel_j, 1, 1, prec);
+}
+
+void
+arb_hypgeom_bessel_y_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec)
+{
+    _arb_hypgeom_bessel_vec(res, nu, z, len, arb_hypgeom_bessel_y, 1, 0, prec);
+}
+
+void
+arb_hypgeom_bessel_i_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec)
+{
+    _arb_hypgeom_bessel_vec(res, nu, z, len, arb_hypgeom_bessel_i, -1, 1, prec);
+}
+
+void
+arb_hypgeom_bessel_i_scaled_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec)
+{
+    _arb_hypgeom_bessel_vec(res, nu, z, len, arb_hypgeom_bessel_i_scaled, -1, 1, prec);
+}
+
+void
+arb_hypgeom_bessel_k_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec)
+{
+    _arb_hypgeom_bessel_vec(res, nu, z, len, arb_hypgeom_bessel_k, -1, 0, prec);
+}
+
+void
+arb_hypgeom_bessel_k_scaled_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec)
+{
+    _arb_hypgeom_bessel_vec(res, nu, z, len, arb_hypgeom_bessel_k_scaled, -1, 0, prec);
+}
+
@@ -0,0 +1,285 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+#include "acb_hypgeom.h"
+
+/* erf(x) = 2x/sqrt(pi) * exp(-x^2) 1F1(1, 3/2, x^2); all terms positive */
+static void
+_arb_hypgeom_erf_1f1(arb_t res, const arb_t z, slong prec)
+{
+    arb_t b, t, w;
+
+    arb_init(b);
+    arb_init(t);
+    arb_init(w);
+
+    arb_set_ui(b, 3);
+    arb_mul_2exp_si(b, b, -1);
+
+    arb_mul(w, z, z, prec);
+
+    arb_hypgeom_pfq_direct(t, NULL, 0, b, 1, w, -1, prec);
+
+    arb_neg(w, w);
+    arb_exp(w, w, prec);
+    arb_mul(t, t, w, prec);
+
+    arb_mul(t, t, z, prec);
+    arb_const_sqrt_pi(w, prec);
+    arb_div(t, t, w, prec);
+
+    arb_mul_2exp_si(res, t, 1);
+
+    arb_clear(b);
+    arb_clear(t);
+    arb_clear(w);
+}
+
+/* |erf'(x)| = 2/sqrt(pi) exp(-x^2) */
+static void
+_arb_hypgeom_erf_propagated_error(mag_t err, const arb_t z)
+{
+    mag_t x;
+
+    mag_init(x);
+
+    arb_get_mag_lower(x, z);
+    mag_mul_lower(x, x, x);
+    mag_expinv(err, x);
+    mag_mul(err, err, arb_radref(z));
+
+    /* 2/sqrt(pi) < 289/256 */
+    mag_mul_ui(err, err, 289);
+    mag_mul_2exp_si(err, err, -8);
+
+    mag_set_ui(x, 2);
+    mag_min(err, err, x);
+
+    mag_clear(x);
+}
+
+static void
+_arb_hypgeom_erf_fallback(arb_t res, const arb_t z, slong prec)
+{
+    acb_t t;
+    acb_init(t);
+    arb_set(acb_realref(t), z);
+    acb_hypgeom_erf(t, t, prec);
+    arb_swap(res, acb_realref(t));
+    acb_clear(t);
+}
+
+void
+arb_hypgeom_erf(arb_t res, const arb_t z, slong prec)
+{
+    slong wp;
+
+    if (!arb_is_finite(z))
+    {
+        arb_indeterminate(res);
+        return;
+    }
+
+    if (arb_is_zero(z))
+    {
+        arb_zero(res);
+        return;
+    }
+
+    if (arf_cmpabs_2exp_si(arb_midref(z), 64) > 0)
+    {
+        _arb_hypgeom_erf_fallback(res, z, prec);
+        return;
+    }
+
+    if (arf_cmpabs_2exp_si(arb_midref(z), -64) >= 0)
+    {
+        double x = arf_get_d(arb_midref(z), ARF_RND_DOWN);
+
+        /* use the asymptotic expansion */
+        if (0.5 * log(x * x) - x * x < -(prec + 8) * 0.69314718055994530942)
+        {
+            _arb_hypgeom_erf_fallback(res, z, prec);
+            return;
+        }
+    }
+
+    wp = prec + 5;
+
+    if (arb_rel_accuracy_bits(z) >= wp)
+    {
+        _arb_hypgeom_erf_1f1(res, z, wp);
+    }
+    else
+    {
+        arb_t zmid;
+        mag_t err;
+
+        arb_init(zmid);
+        mag_init(err);
+
+        _arb_hypgeom_erf_propagated_error(err, z);
+        arf_set(arb_midref(zmid), arb_midref(z));
+
+        _arb_hypgeom_erf_1f1(res, zmid, wp);
+        arb_add_error_mag(res, err);
+
+        arb_clear(zmid);
+        mag_clear(err);
+    }
+
+    arb_set_round(res, res, prec);
+}
+
+void
+arb_hypgeom_erfc(arb_t res, const arb_t z, slong prec)
+{
+    double x, log_erfc_z_asymp;
+    slong wp;
+
+    if (!arb_is_finite(z))
+    {
+        arb_indeterminate(res);
+        return;
+    }
+
+    if (arb_is_zero(z))
+    {
+        arb_one(res);
+        return;
+    }
+
+    if (arf_cmpabs_2exp_si(arb_midref(z), -64) < 0 ||
+        arf_sgn(arb_midref(z)) < 0)
+    {
+        arb_hypgeom_erf(res, z, prec);
+        arb_sub_ui(res, res, 1, prec);
+        arb_neg(res, res);
+        return;
+    }
+
+    x = arf_get_d(arb_midref(z), ARF_RND_DOWN);
+
+    if (arf_cmpabs_2exp_si(arb_midref(z), 64) > 0 ||
+        x * x > (prec + 8) * 0.69314718055994530942)
+    {
+        acb_t t;
+        acb_init(t);
+        arb_set(acb_realref(t), z);
+        acb_hypgeom_erfc(t, t, prec);
+        arb_swap(res, acb_realref(t));
+        acb_clear(t);
+        return;
+    }
+
+    /* compensate for the cancellation in 1 - erf(x) */
+    log_erfc_z_asymp = -x * x - log(x);
+
+    wp = prec + 2;
+    if (log_erfc_z_asymp < 0.0)
+        wp += (-log_erfc_z_asymp) * 1.4426950408889634074;
+
+    if (arb_rel_accuracy_bits(z) >= wp)
+    {
+        arb_hypgeom_erf(res, z, wp);
+    }
+    else
+    {
+        arb_t zmid;
+        mag_t err;
+
+        arb_init(zmid);
+        mag_init(err);
+
+        _arb_hypgeom_erf_propagated_error(err, z);
+        arf_set(arb_midref(zmid), arb_midref(z));
+
+        arb_hypgeom_erf(res, zmid, wp);
+        arb_add_error_mag(res, err);
+
+        arb_clear(zmid);
+        mag_clear(err);
+    }
+
+    arb_sub_ui(res, res, 1, prec);
+    arb_neg(res, res);
+}
+
+/* erfi(x) = 2x/sqrt(pi) * 1F1(1/2, 3/2, x^2); all terms positive */
+void
+arb_hypgeom_erfi(arb_t res, const arb_t z, slong prec)
+{
+    arb_t a, t, w;
+    arb_struct b[2];
+    double x;
+    slong wp;
+
+    if (!arb_is_finite(z))
+    {
+        arb_indeterminate(res);
+        return;
+    }
+
+    if (arb_is_zero(z))
+    {
+        arb_zero(res);
+        return;
+    }
+
+    x = arf_get_d(arb_midref(z), ARF_RND_DOWN);
+
+    /* use the asymptotic expansion */
+    if (arf_cmpabs_2exp_si(arb_midref(z), 64) > 0 ||
+        (arf_cmpabs_2exp_si(arb_midref(z), -64) >= 0 &&
+            0.5 * log(x * x) - x * x < -(prec + 8) * 0.69314718055994530942))
+    {
+        acb_t u;
+        acb_init(u);
+        arb_set(acb_realref(u), z);
+        acb_hypgeom_erfi(u, u, prec);
+        arb_swap(res, acb_realref(u));
+        acb_clear(u);
+        return;
+    }
+
+    arb_init(a);
+    arb_init(b);
+    arb_init(b + 1);
+    arb_init(t);
+    arb_init(w);
+
+    wp = prec + 5;
+
+    arb_one(a);
+    arb_mul_2exp_si(a, a, -1);
+    arb_set_ui(b, 3);
+    arb_mul_2exp_si(b, b, -1);
+    arb_one(b + 1);
+
+    arb_mul(w, z, z, wp);
+
+    arb_hypgeom_pfq_direct(t, a, 1, b, 2, w, -1, wp);
+
+    arb_mul(t, t, z, wp);
+    arb_const_sqrt_pi(w, wp);
+    arb_div(t, t, w, wp);
+
+    arb_mul_2exp_si(res, t, 1);
+    arb_set_round(res, res, prec);
+
+    arb_clear(a);
+    arb_clear(b);
+    arb_clear(b + 1);
+    arb_clear(t);
+    arb_clear(w);
+}
+
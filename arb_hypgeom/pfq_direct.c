@@ -0,0 +1,59 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+#include "acb_hypgeom.h"
+
+void
+arb_hypgeom_pfq_direct(arb_t res, arb_srcptr a, slong p, arb_srcptr b, slong q,
+    const arb_t z, slong n, slong prec)
+{
+    arb_t s, t;
+    acb_ptr v;
+    mag_t err, C;
+    slong i;
+
+    arb_init(s);
+    arb_init(t);
+    mag_init(err);
+    mag_init(C);
+
+    /* the choice of n and the tail bound only depend on a few
+       scalar quantities; reuse the complex code for them */
+    v = _acb_vec_init(p + q + 1);
+    for (i = 0; i < p; i++)
+        arb_set(acb_realref(v + i), a + i);
+    for (i = 0; i < q; i++)
+        arb_set(acb_realref(v + p + i), b + i);
+    arb_set(acb_realref(v + p + q), z);
+
+    if (n < 0)
+        n = acb_hypgeom_pfq_choose_n(v, p, v + p, q, v + p + q, prec);
+
+    arb_hypgeom_pfq_sum(s, t, a, p, b, q, z, n, prec);
+
+    if (!arb_is_zero(t))
+    {
+        acb_hypgeom_pfq_bound_factor(C, v, p, v + p, q, v + p + q, n);
+        arb_get_mag(err, t);
+        mag_mul(err, err, C);
+        arb_add_error_mag(s, err);
+    }
+
+    arb_swap(res, s);
+
+    _acb_vec_clear(v, p + q + 1);
+    arb_clear(s);
+    arb_clear(t);
+    mag_clear(err);
+    mag_clear(C);
+}
+
@@ -0,0 +1,34 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+void
+arb_hypgeom_pfq_sum(arb_t s, arb_t t, arb_srcptr a, slong p,
+    arb_srcptr b, slong q, const arb_t z, slong n, slong prec)
+{
+    if (n > 4 && prec >= 128
+        && _arb_vec_bits(a, p) * p + _arb_vec_bits(b, q) * q + 10 < prec / 2)
+    {
+        if (prec >= 256 && arb_bits(z) < prec * 0.01)
+            arb_hypgeom_pfq_sum_bs(s, t, a, p, b, q, z, n, prec);
+        else
+            arb_hypgeom_pfq_sum_rs(s, t, a, p, b, q, z, n, prec);
+    }
+    else
+    {
+        if (n > 8)
+            arb_hypgeom_pfq_sum_bs(s, t, a, p, b, q, z, n, prec);
+        else
+            arb_hypgeom_pfq_sum_forward(s, t, a, p, b, q, z, n, prec);
+    }
+}
+
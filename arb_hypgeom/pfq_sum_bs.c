@@ -0,0 +1,256 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+#include "hypgeom.h"
+
+/*
+
+[S(k+1)] = [ R(k)  0   ] [S(k)]
+[T(k+1)]   [ 1     1   ] [T(k)]
+
+[S(k+1)] = [ P(k) / Q(k)  0   ] [S(k)]
+[T(k+1)]   [ 1            1   ] [T(k)]
+
+
+  1  [ P(k)         ]
+---- [              ]
+Q(k) [ Q(k)   Q(k)  ]
+
+[[A2 0] [B2 C2]] . [[A1 0] [B1 C1]] = [[A1 A2 0] [A1 B2 + B1 C2   C1 C2]
+
+A1 B2 + B1 B2 = B2 (A1 + B1) -- use to save time?
+
+*/
+
+static void
+factor(arb_t A, arb_t tmp, arb_srcptr a, slong p, const arb_t z, slong k, slong prec)
+{
+    slong i;
+
+    if (p == 0)
+    {
+        if (z == NULL)
+            arb_one(A);
+        else
+            arb_set(A, z);
+    }
+    else
+    {
+        arb_add_ui(A, a, k, prec);
+
+        for (i = 1; i < p; i++)
+        {
+            arb_add_ui(tmp, a + i, k, prec);
+            arb_mul(A, A, tmp, prec);
+        }
+
+        if (z != NULL)
+            arb_mul(A, A, z, prec);
+    }
+}
+
+static void
+bsplit(arb_t A1, arb_t B1, arb_t C1,
+        arb_srcptr a, slong p,
+        arb_srcptr b, slong q,
+        const arb_t z,
+        slong aa,
+        slong bb,
+        slong prec)
+{
+    if (bb - aa == 1)
+    {
+        factor(A1, B1, a, p, z, aa, prec);
+        factor(C1, B1, b, q, NULL, aa, prec);
+        /* arb_set(B1, C1);   but we skip this */
+    }
+    else
+    {
+        slong m;
+
+        arb_t A2, B2, C2;
+
+        arb_init(A2);
+        arb_init(B2);
+        arb_init(C2);
+
+        m = aa + (bb - aa) / 2;
+
+        bsplit(A1, B1, C1, a, p, b, q, z, aa, m, prec);
+        bsplit(A2, B2, C2, a, p, b, q, z, m, bb, prec);
+
+        if (bb - m == 1)  /* B2 = C2 */
+        {
+            if (m - aa == 1)
+                arb_add(B2, A1, C1, prec);
+            else
+                arb_add(B2, A1, B1, prec);
+
+            arb_mul(B1, B2, C2, prec);
+        }
+        else
+        {
+            if (m - aa == 1)
+                arb_mul(B1, C1, C2, prec);
+            else
+                arb_mul(B1, B1, C2, prec);
+
+            arb_addmul(B1, A1, B2, prec);
+        }
+
+        arb_mul(A1, A1, A2, prec);
+        arb_mul(C1, C1, C2, prec);
+
+        arb_clear(A2);
+        arb_clear(B2);
+        arb_clear(C2);
+    }
+}
+
+typedef struct
+{
+    arb_t A;
+    arb_t B;
+    arb_t C;
+}
+bsplit_res_t;
+
+typedef struct
+{
+    arb_srcptr a;
+    slong p;
+    arb_srcptr b;
+    slong q;
+    arb_srcptr z;
+    slong prec;
+}
+bsplit_args_t;
+
+static void
+bsplit_init(void * x, void * args)
+{
+    bsplit_res_t * r = x;
+    arb_init(r->A);
+    arb_init(r->B);
+    arb_init(r->C);
+}
+
+static void
+bsplit_clear(void * x, void * args)
+{
+    bsplit_res_t * r = x;
+    arb_clear(r->A);
+    arb_clear(r->B);
+    arb_clear(r->C);
+}
+
+static void
+bsplit_basecase(void * x, slong aa, slong bb, void * args)
+{
+    bsplit_res_t * r = x;
+    bsplit_args_t * s = args;
+
+    bsplit(r->A, r->B, r->C, s->a, s->p, s->b, s->q, s->z, aa, bb, s->prec);
+
+    if (bb - aa == 1)
+        arb_set(r->B, r->C);
+}
+
+static void
+bsplit_merge(void * x, void * y, void * args)
+{
+    bsplit_res_t * r = x;
+    bsplit_res_t * r2 = y;
+    slong prec = ((bsplit_args_t *) args)->prec;
+
+    arb_mul(r->B, r->B, r2->C, prec);
+    arb_addmul(r->B, r->A, r2->B, prec);
+    arb_mul(r->A, r->A, r2->A, prec);
+    arb_mul(r->C, r->C, r2->C, prec);
+}
+
+/* evaluates the product tree using several threads when worthwhile */
+static void
+bsplit_parallel(arb_t A1, arb_t B1, arb_t C1,
+        arb_srcptr a, slong p,
+        arb_srcptr b, slong q,
+        const arb_t z,
+        slong aa,
+        slong bb,
+        slong prec)
+{
+    if (flint_get_num_threads() > 1 && bb - aa >= 64
+        && prec >= hypgeom_bsplit_threaded_cutoff)
+    {
+        bsplit_res_t r;
+        bsplit_args_t args;
+
+        args.a = a;
+        args.p = p;
+        args.b = b;
+        args.q = q;
+        args.z = z;
+        args.prec = prec;
+
+        bsplit_init(&r, &args);
+        hypgeom_parallel_binary_splitting(&r, bsplit_basecase, bsplit_merge,
+            sizeof(bsplit_res_t), bsplit_init, bsplit_clear, &args,
+            aa, bb, 16, -1);
+        arb_swap(A1, r.A);
+        arb_swap(B1, r.B);
+        arb_swap(C1, r.C);
+        bsplit_clear(&r, &args);
+    }
+    else
+    {
+        bsplit(A1, B1, C1, a, p, b, q, z, aa, bb, prec);
+    }
+}
+
+void
+arb_hypgeom_pfq_sum_bs(arb_t s, arb_t t,
+    arb_srcptr a, slong p, arb_srcptr b, slong q, const arb_t z, slong n, slong prec)
+{
+    arb_t u, v, w, tmp;
+
+    if (n < 4)
+    {
+        arb_hypgeom_pfq_sum_forward(s, t, a, p, b, q, z, n, prec);
+        return;
+    }
+
+    arb_init(u);
+    arb_init(v);
+    arb_init(w);
+    arb_init(tmp);
+
+    /* we compute to n-1 instead of n to avoid dividing by 0 in the
+       denominator when computing a hypergeometric polynomial
+       that terminates right before a pole */
+    bsplit_parallel(u, v, w, a, p, b, q, z, 0, n - 1, prec);
+
+    arb_add(s, u, v, prec); /* s = s + t */
+    arb_div(s, s, w, prec);
+
+    /* split off last factor */
+    factor(t, tmp, a, p, z, n - 1, prec);
+    arb_mul(u, u, t, prec);
+    factor(t, tmp, b, q, NULL, n - 1, prec);
+    arb_mul(w, w, t, prec);
+    arb_div(t, u, w, prec);
+
+    arb_clear(u);
+    arb_clear(v);
+    arb_clear(w);
+    arb_clear(tmp);
+}
+
@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+void
+arb_hypgeom_pfq_sum_forward(arb_t s, arb_t t,
+    arb_srcptr a, slong p, arb_srcptr b, slong q, const arb_t z, slong n, slong prec)
+{
+    arb_t u, v;
+    slong k, i;
+
+    arb_init(u);
+    arb_init(v);
+
+    arb_zero(s);
+    arb_one(t);
+
+    for (k = 0; k < n && !arb_is_zero(t); k++)
+    {
+        arb_add(s, s, t, prec);
+
+        if (p > 0)
+        {
+            arb_add_ui(u, a, k, prec);
+
+            for (i = 1; i < p; i++)
+            {
+                arb_add_ui(v, a + i, k, prec);
+                arb_mul(u, u, v, prec);
+            }
+
+            arb_mul(t, t, u, prec);
+        }
+
+        if (q > 0)
+        {
+            arb_add_ui(u, b, k, prec);
+
+            for (i = 1; i < q; i++)
+            {
+                arb_add_ui(v, b + i, k, prec);
+                arb_mul(u, u, v, prec);
+            }
+
+            arb_div(t, t, u, prec);
+        }
+
+        arb_mul(t, t, z, prec);
+    }
+
+    arb_clear(u);
+    arb_clear(v);
+}
+
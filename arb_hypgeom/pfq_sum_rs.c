@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+void
+arb_hypgeom_pfq_sum_rs(arb_t res, arb_t term, arb_srcptr a, slong p,
+                                              arb_srcptr b, slong q, const arb_t z, slong n, slong prec)
+{
+    arb_ptr zpow;
+    arb_t s, t, u;
+    slong i, j, k, m;
+    mag_t B, C;
+
+    if (n == 0)
+    {
+        arb_zero(res);
+        arb_one(term);
+        return;
+    }
+
+    if (n < 0)
+        flint_abort();
+
+    m = n_sqrt(n);
+    m = FLINT_MIN(m, 150);
+
+    mag_init(B);
+    mag_init(C);
+    arb_init(s);
+    arb_init(t);
+    arb_init(u);
+    zpow = _arb_vec_init(m + 1);
+
+    _arb_vec_set_powers(zpow, z, m + 1, prec);
+
+    mag_one(B);
+
+    for (k = n; k >= 0; k--)
+    {
+        j = k % m;
+
+        if (k < n)
+            arb_add(s, s, zpow + j, prec);
+
+        if (k > 0)
+        {
+            if (p > 0)
+            {
+                arb_add_ui(u, a, k - 1, prec);
+
+                for (i = 1; i < p; i++)
+                {
+                    arb_add_ui(t, a + i, k - 1, prec);
+                    arb_mul(u, u, t, prec);
+                }
+
+                if (k < n)
+                    arb_mul(s, s, u, prec);
+
+                arb_get_mag(C, u);
+                mag_mul(B, B, C);
+            }
+
+            if (q > 0)
+            {
+                arb_add_ui(u, b, k - 1, prec);
+
+                for (i = 1; i < q; i++)
+                {
+                    arb_add_ui(t, b + i, k - 1, prec);
+                    arb_mul(u, u, t, prec);
+                }
+
+                if (k < n)
+                    arb_div(s, s, u, prec);
+
+                arb_get_mag_lower(C, u);
+                mag_div(B, B, C);
+            }
+
+            if (j == 0 && k < n)
+            {
+                arb_mul(s, s, zpow + m, prec);
+            }
+        }
+    }
+
+    arb_get_mag(C, z);
+    mag_pow_ui(C, C, n);
+    mag_mul(B, B, C);
+
+    arb_zero(term);
+    arb_add_error_mag(term, B);
+
+    arb_set(res, s);
+
+    mag_clear(B);
+    mag_clear(C);
+    arb_clear(s);
+    arb_clear(t);
+    arb_clear(u);
+    _arb_vec_clear(zpow, m + 1);
+}
+
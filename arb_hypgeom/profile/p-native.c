@@ -0,0 +1,144 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "arb_hypgeom.h"
+#include "acb_hypgeom.h"
+#include "flint/profiler.h"
+
+/*
+    Compares the real-argument implementations in arb_hypgeom with
+    evaluating the same functions through acb_hypgeom, as the arb_hypgeom
+    functions used to do.
+
+    usage: p-native
+*/
+
+#define NUM_FUNCS 6
+
+static const char * func_names[NUM_FUNCS] =
+    { "erf", "erfc", "erfi", "0f1", "bessel_j", "bessel_i" };
+
+static void
+eval_real(arb_t res, int func, const arb_t nu, const arb_t z, slong prec)
+{
+    switch (func)
+    {
+        case 0: arb_hypgeom_erf(res, z, prec); break;
+        case 1: arb_hypgeom_erfc(res, z, prec); break;
+        case 2: arb_hypgeom_erfi(res, z, prec); break;
+        case 3: arb_hypgeom_0f1(res, nu, z, 0, prec); break;
+        case 4: arb_hypgeom_bessel_j(res, nu, z, prec); break;
+        default: arb_hypgeom_bessel_i(res, nu, z, prec); break;
+    }
+}
+
+static void
+eval_complex(arb_t res, int func, const arb_t nu, const arb_t z, slong prec)
+{
+    acb_t t, u;
+
+    acb_init(t);
+    acb_init(u);
+
+    acb_set_arb(t, nu);
+    acb_set_arb(u, z);
+
+    switch (func)
+    {
+        case 0: acb_hypgeom_erf(t, u, prec); break;
+        case 1: acb_hypgeom_erfc(t, u, prec); break;
+        case 2: acb_hypgeom_erfi(t, u, prec); break;
+        case 3: acb_hypgeom_0f1(t, t, u, 0, prec); break;
+        case 4: acb_hypgeom_bessel_j(t, t, u, prec); break;
+        default: acb_hypgeom_bessel_i(t, t, u, prec); break;
+    }
+
+    arb_swap(res, acb_realref(t));
+
+    acb_clear(t);
+    acb_clear(u);
+}
+
+static double
+time_eval(int use_acb, int func, arb_t res, const arb_t nu, const arb_t z, slong prec)
+{
+    timeit_t timer;
+    slong i, reps;
+
+    for (reps = 1; ; reps *= 2)
+    {
+        timeit_start(timer);
+        for (i = 0; i < reps; i++)
+        {
+            if (use_acb)
+                eval_complex(res, func, nu, z, prec);
+            else
+                eval_real(res, func, nu, z, prec);
+        }
+        timeit_stop(timer);
+
+        if (timer->wall >= 20)
+            break;
+    }
+
+    return (double) timer->wall / reps;
+}
+
+int main()
+{
+    slong prec_tab[4] = { 64, 256, 1024, 4096 };
+    const char * x_tab[3] = { "0.75", "3.25", "12.5" };
+    slong i, j, prec;
+    int func;
+    double t1, t2;
+    arb_t nu, z, r1, r2;
+
+    arb_init(nu);
+    arb_init(z);
+    arb_init(r1);
+    arb_init(r2);
+
+    arb_set_d(nu, 0.375);
+
+    flint_printf("%10s %6s %6s %12s %12s %8s %8s %8s\n", "function", "x", "prec",
+        "real (ms)", "complex (ms)", "speedup", "acc1", "acc2");
+
+    for (func = 0; func < NUM_FUNCS; func++)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            for (j = 0; j < 4; j++)
+            {
+                prec = prec_tab[j];
+                arb_set_str(z, x_tab[i], prec);
+
+                t1 = time_eval(0, func, r1, nu, z, prec);
+                t2 = time_eval(1, func, r2, nu, z, prec);
+
+                flint_printf("%10s %6s %6wd %12g %12g %8.3f %8wd %8wd\n",
+                    func_names[func], x_tab[i], prec, t1, t2, t2 / t1,
+                    arb_rel_accuracy_bits(r1), arb_rel_accuracy_bits(r2));
+            }
+        }
+
+        flint_printf("\n");
+    }
+
+    arb_clear(nu);
+    arb_clear(z);
+    arb_clear(r1);
+    arb_clear(r2);
+
+    flint_cleanup();
+    return EXIT_SUCCESS;
+}
+
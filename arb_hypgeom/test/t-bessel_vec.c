@@ -0,0 +1,175 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+typedef void (*bessel_func_t)(arb_t, const arb_t, const arb_t, slong);
+typedef void (*bessel_vec_func_t)(arb_ptr, const arb_t, const arb_t, slong, slong);
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    bessel_func_t func[6] = {
+        arb_hypgeom_bessel_j, arb_hypgeom_bessel_y,
+        arb_hypgeom_bessel_i, arb_hypgeom_bessel_i_scaled,
+        arb_hypgeom_bessel_k, arb_hypgeom_bessel_k_scaled };
+
+    bessel_vec_func_t vec_func[6] = {
+        arb_hypgeom_bessel_j_vec, arb_hypgeom_bessel_y_vec,
+        arb_hypgeom_bessel_i_vec, arb_hypgeom_bessel_i_scaled_vec,
+        arb_hypgeom_bessel_k_vec, arb_hypgeom_bessel_k_scaled_vec };
+
+    flint_printf("bessel_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
+    {
+        arb_ptr res;
+        arb_t nu, z, t, y;
+        slong k, len, prec1, prec2;
+        int which;
+
+        arb_init(nu);
+        arb_init(z);
+        arb_init(t);
+        arb_init(y);
+
+        which = n_randint(state, 6);
+        len = n_randint(state, 30);
+        prec1 = 2 + n_randint(state, 200);
+        prec2 = 2 + n_randint(state, 200);
+
+        if (n_randint(state, 2))
+            arb_set_si(nu, n_randint(state, 10));
+        else
+            arb_randtest(nu, state, 1 + n_randint(state, 200), 3);
+
+        arb_randtest(z, state, 1 + n_randint(state, 200), 4);
+
+        res = _arb_vec_init(len);
+
+        vec_func[which](res, nu, z, len, prec1);
+
+        for (k = 0; k < len; k++)
+        {
+            arb_add_si(t, nu, k, prec2);
+            func[which](y, t, z, prec2);
+
+            if (!arb_overlaps(res + k, y))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("which = %d, len = %wd, k = %wd\n\n", which, len, k);
+                flint_printf("nu = "); arb_printd(nu, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+                flint_printf("res = "); arb_printd(res + k, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _arb_vec_clear(res, len);
+
+        /* I and K of integer order at an exact positive argument should
+           be obtained with close to full accuracy */
+        if (which >= 2)
+        {
+            prec1 = 64 + n_randint(state, 200);
+            len = 1 + n_randint(state, 40);
+            arb_set_si(nu, n_randint(state, 5));
+            arb_set_ui(z, 1 + n_randint(state, 1000));
+            arb_mul_2exp_si(z, z, -7);
+
+            res = _arb_vec_init(len);
+            vec_func[which](res, nu, z, len, prec1);
+
+            for (k = 0; k < len; k++)
+            {
+                if (arb_rel_accuracy_bits(res + k) < prec1 - 20)
+                {
+                    flint_printf("FAIL: accuracy\n\n");
+                    flint_printf("which = %d, len = %wd, k = %wd, prec = %wd\n\n",
+                        which, len, k, prec1);
+                    flint_printf("nu = "); arb_printd(nu, 30); flint_printf("\n\n");
+                    flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+                    flint_printf("res = "); arb_printd(res + k, 30); flint_printf("\n\n");
+                    flint_abort();
+                }
+            }
+
+            _arb_vec_clear(res, len);
+        }
+
+        /* J and Y at large z, where the recurrence runs through the
+           oscillatory region, should be as accurate as direct evaluation */
+        if (which <= 1 && iter % 4 == 0)
+        {
+            mag_t err, m;
+
+            mag_init(err);
+            mag_init(m);
+
+            prec1 = 30 + n_randint(state, 200);
+            len = 1 + n_randint(state, 150);
+            arb_set_si(nu, n_randint(state, 40));
+            arb_mul_2exp_si(nu, nu, -2);
+            arb_set_ui(z, 200 + n_randint(state, 1800));
+            arb_mul_2exp_si(z, z, -1);
+
+            res = _arb_vec_init(len);
+            vec_func[which](res, nu, z, len, prec1);
+
+            for (k = 0; k < len; k++)
+            {
+                arb_add_si(t, nu, k, prec1);
+                func[which](y, t, z, prec1);
+
+                /* allow the radius of the direct value plus a rounding
+                   error relative to its magnitude, with some slack */
+                arf_get_mag(m, arb_midref(y));
+                mag_mul_2exp_si(m, m, -prec1);
+                mag_add(err, arb_radref(y), m);
+                mag_mul_2exp_si(err, err, 12);
+
+                if (!arb_overlaps(res + k, y) ||
+                    mag_cmp(arb_radref(res + k), err) > 0)
+                {
+                    flint_printf("FAIL: accuracy (large z)\n\n");
+                    flint_printf("which = %d, len = %wd, k = %wd, prec = %wd\n\n",
+                        which, len, k, prec1);
+                    flint_printf("nu = "); arb_printd(nu, 30); flint_printf("\n\n");
+                    flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+                    flint_printf("res = "); arb_printd(res + k, 30); flint_printf("\n\n");
+                    flint_printf("y = "); arb_printd(y, 30); flint_printf("\n\n");
+                    flint_abort();
+                }
+            }
+
+            _arb_vec_clear(res, len);
+            mag_clear(err);
+            mag_clear(m);
+        }
+
+        arb_clear(nu);
+        arb_clear(z);
+        arb_clear(t);
+        arb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
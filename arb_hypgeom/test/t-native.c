@@ -0,0 +1,126 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+#include "acb_hypgeom.h"
+
+/* compare the real-argument implementations with the complex ones */
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("native....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 3000 * arb_test_multiplier(); iter++)
+    {
+        arb_t nu, z, r1;
+        acb_t nuc, zc, r2;
+        slong prec1, prec2;
+        int func;
+
+        arb_init(nu);
+        arb_init(z);
+        arb_init(r1);
+        acb_init(nuc);
+        acb_init(zc);
+        acb_init(r2);
+
+        prec1 = 2 + n_randint(state, 800);
+        prec2 = 2 + n_randint(state, 800);
+        func = n_randint(state, 8);
+
+        arb_randtest(z, state, 1 + n_randint(state, 800), 1 + n_randint(state, 7));
+
+        if (n_randint(state, 2))
+            arb_set_si(nu, (slong) n_randint(state, 20) - 10);
+        else
+            arb_randtest(nu, state, 1 + n_randint(state, 800), 1 + n_randint(state, 4));
+
+        acb_set_arb(nuc, nu);
+        acb_set_arb(zc, z);
+
+        switch (func)
+        {
+            case 0:
+                arb_hypgeom_erf(r1, z, prec1);
+                acb_hypgeom_erf(r2, zc, prec2);
+                break;
+            case 1:
+                arb_hypgeom_erfc(r1, z, prec1);
+                acb_hypgeom_erfc(r2, zc, prec2);
+                break;
+            case 2:
+                arb_hypgeom_erfi(r1, z, prec1);
+                acb_hypgeom_erfi(r2, zc, prec2);
+                break;
+            case 3:
+                arb_hypgeom_0f1(r1, nu, z, 0, prec1);
+                acb_hypgeom_0f1(r2, nuc, zc, 0, prec2);
+                break;
+            case 4:
+                arb_hypgeom_0f1(r1, nu, z, 1, prec1);
+                acb_hypgeom_0f1(r2, nuc, zc, 1, prec2);
+                break;
+            case 5:
+                arb_hypgeom_bessel_j(r1, nu, z, prec1);
+                acb_hypgeom_bessel_j(r2, nuc, zc, prec2);
+                break;
+            case 6:
+                arb_hypgeom_bessel_i(r1, nu, z, prec1);
+                acb_hypgeom_bessel_i(r2, nuc, zc, prec2);
+                break;
+            default:
+                arb_hypgeom_bessel_i_scaled(r1, nu, z, prec1);
+                acb_hypgeom_bessel_i_scaled(r2, nuc, zc, prec2);
+                break;
+        }
+
+        if (!arb_overlaps(r1, acb_realref(r2)))
+        {
+            flint_printf("FAIL: overlap (func = %d)\n\n", func);
+            flint_printf("nu = "); arb_printd(nu, 30); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+            flint_printf("r1 = "); arb_printd(r1, 30); flint_printf("\n\n");
+            flint_printf("r2 = "); acb_printd(r2, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* exact input at high precision should give an accurate result */
+        if (func <= 2 && arb_is_exact(z) && prec1 >= 64 &&
+            arf_cmpabs_2exp_si(arb_midref(z), 3) < 0 &&
+            arb_rel_accuracy_bits(r1) < prec1 - 20)
+        {
+            flint_printf("FAIL: accuracy (func = %d)\n\n", func);
+            flint_printf("prec1 = %wd\n\n", prec1);
+            flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+            flint_printf("r1 = "); arb_printd(r1, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arb_clear(nu);
+        arb_clear(z);
+        arb_clear(r1);
+        acb_clear(nuc);
+        acb_clear(zc);
+        acb_clear(r2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
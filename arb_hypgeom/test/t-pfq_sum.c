@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+#include "acb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("pfq_sum....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000 * arb_test_multiplier(); iter++)
+    {
+        arb_ptr a, b;
+        acb_ptr ac, bc;
+        arb_t z, s1, s2, t1, t2;
+        acb_t zc, s3, t3;
+        slong i, p, q, n, prec1, prec2;
+        int alg;
+
+        p = n_randint(state, 5);
+        q = n_randint(state, 5);
+        n = n_randint(state, 300);
+        prec1 = 2 + n_randint(state, 500);
+        prec2 = 2 + n_randint(state, 500);
+        alg = n_randint(state, 4);
+
+        arb_init(z);
+        arb_init(s1);
+        arb_init(s2);
+        arb_init(t1);
+        arb_init(t2);
+        acb_init(zc);
+        acb_init(s3);
+        acb_init(t3);
+
+        arb_randtest_special(z, state, 1 + n_randint(state, 500), 1 + n_randint(state, 100));
+        arb_randtest_special(s1, state, 1 + n_randint(state, 500), 1 + n_randint(state, 100));
+        arb_randtest_special(t1, state, 1 + n_randint(state, 500), 1 + n_randint(state, 100));
+        arb_randtest_special(s2, state, 1 + n_randint(state, 500), 1 + n_randint(state, 100));
+        arb_randtest_special(t2, state, 1 + n_randint(state, 500), 1 + n_randint(state, 100));
+
+        a = _arb_vec_init(p);
+        b = _arb_vec_init(q);
+        ac = _acb_vec_init(p);
+        bc = _acb_vec_init(q);
+
+        for (i = 0; i < p; i++)
+        {
+            arb_randtest(a + i, state, 1 + n_randint(state, 100), 1 + n_randint(state, 10));
+            acb_set_arb(ac + i, a + i);
+        }
+
+        for (i = 0; i < q; i++)
+        {
+            arb_randtest(b + i, state, 1 + n_randint(state, 100), 1 + n_randint(state, 10));
+            acb_set_arb(bc + i, b + i);
+        }
+
+        acb_set_arb(zc, z);
+
+        arb_hypgeom_pfq_sum_forward(s1, t1, a, p, b, q, z, n, prec1);
+
+        switch (alg)
+        {
+            case 0:
+                arb_hypgeom_pfq_sum_rs(s2, t2, a, p, b, q, z, n, prec2);
+                break;
+            case 1:
+                arb_hypgeom_pfq_sum_bs(s2, t2, a, p, b, q, z, n, prec2);
+                break;
+            case 2:
+                arb_hypgeom_pfq_sum(s2, t2, a, p, b, q, z, n, prec2);
+                break;
+            default:
+                arb_hypgeom_pfq_sum_forward(s2, t2, a, p, b, q, z, n, prec2);
+                break;
+        }
+
+        acb_hypgeom_pfq_sum_forward(s3, t3, ac, p, bc, q, zc, n, prec2);
+
+        if (!arb_overlaps(s1, s2) || !arb_overlaps(t1, t2)
+            || !arb_overlaps(s1, acb_realref(s3)) || !arb_overlaps(t1, acb_realref(t3)))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("alg = %d, n = %wd\n\n", alg, n);
+            flint_printf("z = "); arb_print(z); flint_printf("\n\n");
+            flint_printf("s1 = "); arb_print(s1); flint_printf("\n\n");
+            flint_printf("s2 = "); arb_print(s2); flint_printf("\n\n");
+            flint_printf("s3 = "); acb_print(s3); flint_printf("\n\n");
+            flint_printf("t1 = "); arb_print(t1); flint_printf("\n\n");
+            flint_printf("t2 = "); arb_print(t2); flint_printf("\n\n");
+            flint_printf("t3 = "); acb_print(t3); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        _arb_vec_clear(a, p);
+        _arb_vec_clear(b, q);
+        _acb_vec_clear(ac, p);
+        _acb_vec_clear(bc, q);
+
+        arb_clear(z);
+        arb_clear(s1);
+        arb_clear(s2);
+        arb_clear(t1);
+        arb_clear(t2);
+        acb_clear(zc);
+        acb_clear(s3);
+        acb_clear(t3);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
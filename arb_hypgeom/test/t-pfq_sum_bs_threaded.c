@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+#include "hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("pfq_sum_bs_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* exercise the threaded code at small precision */
+    hypgeom_bsplit_threaded_cutoff = 0;
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        arb_ptr a, b;
+        arb_t z, s1, s2, s3, t1, t2, t3;
+        slong i, p, q, n, prec, num_threads;
+
+        p = n_randint(state, 4);
+        q = n_randint(state, 4);
+        n = n_randint(state, 400);
+        prec = 2 + n_randint(state, 500);
+        num_threads = 2 + n_randint(state, 6);
+
+        arb_init(z);
+        arb_init(s1);
+        arb_init(s2);
+        arb_init(s3);
+        arb_init(t1);
+        arb_init(t2);
+        arb_init(t3);
+
+        a = _arb_vec_init(p);
+        b = _arb_vec_init(q);
+
+        for (i = 0; i < p; i++)
+            arb_randtest(a + i, state, 1 + n_randint(state, 100), 1 + n_randint(state, 10));
+
+        for (i = 0; i < q; i++)
+            arb_randtest(b + i, state, 1 + n_randint(state, 100), 1 + n_randint(state, 10));
+
+        arb_randtest(z, state, 1 + n_randint(state, 300), 1 + n_randint(state, 3));
+
+        flint_set_num_threads(1);
+        arb_hypgeom_pfq_sum_bs(s1, t1, a, p, b, q, z, n, prec);
+
+        flint_set_num_threads(num_threads);
+        arb_hypgeom_pfq_sum_bs(s2, t2, a, p, b, q, z, n, prec);
+        arb_hypgeom_pfq_sum_bs(s3, t3, a, p, b, q, z, n, prec);
+
+        /* the threaded tree depends only on the number of threads */
+        if (!arb_overlaps(s1, s2) || !arb_overlaps(t1, t2) ||
+            !arb_equal(s2, s3) || !arb_equal(t2, t3))
+        {
+            flint_printf("FAIL (iter = %wd)\n\n", iter);
+            flint_printf("n = %wd, prec = %wd, num_threads = %wd\n\n",
+                n, prec, num_threads);
+            flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+            flint_printf("s1 = "); arb_printd(s1, 30); flint_printf("\n\n");
+            flint_printf("s2 = "); arb_printd(s2, 30); flint_printf("\n\n");
+            flint_printf("s3 = "); arb_printd(s3, 30); flint_printf("\n\n");
+            flint_printf("t1 = "); arb_printd(t1, 30); flint_printf("\n\n");
+            flint_printf("t2 = "); arb_printd(t2, 30); flint_printf("\n\n");
+            flint_printf("t3 = "); arb_printd(t3, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* the forward recurrence gives an independent enclosure */
+        arb_hypgeom_pfq_sum_forward(s1, t1, a, p, b, q, z, n, prec);
+
+        if (!arb_overlaps(s1, s2) || !arb_overlaps(t1, t2))
+        {
+            flint_printf("FAIL: forward (iter = %wd)\n\n", iter);
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_printf("s1 = "); arb_printd(s1, 30); flint_printf("\n\n");
+            flint_printf("s2 = "); arb_printd(s2, 30); flint_printf("\n\n");
+            flint_printf("t1 = "); arb_printd(t1, 30); flint_printf("\n\n");
+            flint_printf("t2 = "); arb_printd(t2, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        _arb_vec_clear(a, p);
+        _arb_vec_clear(b, q);
+
+        arb_clear(z);
+        arb_clear(s1);
+        arb_clear(s2);
+        arb_clear(s3);
+        arb_clear(t1);
+        arb_clear(t2);
+        arb_clear(t3);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
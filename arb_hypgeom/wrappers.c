@@ -12,60 +12,6 @@
 #include "arb_hypgeom.h"
 #include "acb_hypgeom.h"
 
-void
-arb_hypgeom_erf(arb_t res, const arb_t z, slong prec)
-{
-    if (!arb_is_finite(z))
-    {
-        arb_indeterminate(res);
-    }
-    else
-    {
-        acb_t t;
-        acb_init(t);
-        arb_set(acb_realref(t), z);
-        acb_hypgeom_erf(t, t, prec);
-        arb_swap(res, acb_realref(t));
-        acb_clear(t);
-    }
-}
-
-void
-arb_hypgeom_erfc(arb_t res, const arb_t z, slong prec)
-{
-    if (!arb_is_finite(z))
-    {
-        arb_indeterminate(res);
-    }
-    else
-    {
-        acb_t t;
-        acb_init(t);
-        arb_set(acb_realref(t), z);
-        acb_hypgeom_erfc(t, t, prec);
-        arb_swap(res, acb_realref(t));
-        acb_clear(t);
-    }
-}
-
-void
-arb_hypgeom_erfi(arb_t res, const arb_t z, slong prec)
-{
-    if (!arb_is_finite(z))
-    {
-        arb_indeterminate(res);
-    }
-    else
-    {
-        acb_t t;
-        acb_init(t);
-        arb_set(acb_realref(t), z);
-        acb_hypgeom_erfi(t, t, prec);
-        arb_swap(res, acb_realref(t));
-        acb_clear(t);
-    }
-}
-
 void
 arb_hypgeom_fresnel(arb_t res1, arb_t res2, const arb_t z, int normalized, slong prec)
 {
@@ -196,23 +142,6 @@ arb_hypgeom_li(arb_t res, const arb_t z, int offset, slong prec)
     }
 }
 
-void
-arb_hypgeom_0f1(arb_t res, const arb_t a, const arb_t z, int regularized, slong prec)
-{
-    acb_t t, u;
-    acb_init(t);
-    acb_init(u);
-    arb_set(acb_realref(t), a);
-    arb_set(acb_realref(u), z);
-    acb_hypgeom_0f1(t, t, u, regularized, prec);
-    if (acb_is_finite(t) && acb_is_real(t))
-        arb_swap(res, acb_realref(t));
-    else
-        arb_indeterminate(res);
-    acb_clear(t);
-    acb_clear(u);
-}
-
 void
 arb_hypgeom_m(arb_t res, const arb_t a, const arb_t b, const arb_t z, int regularized, slong prec)
 {
@@ -301,23 +230,6 @@ arb_hypgeom_pfq(arb_t res, arb_srcptr a, slong p, arb_srcptr b, slong q, const a
     _acb_vec_clear(t, p + q + 1);
 }
 
-void
-arb_hypgeom_bessel_j(arb_t res, const arb_t nu, const arb_t z, slong prec)
-{
-    acb_t t, u;
-    acb_init(t);
-    acb_init(u);
-    arb_set(acb_realref(t), nu);
-    arb_set(acb_realref(u), z);
-    acb_hypgeom_bessel_j(t, t, u, prec);
-    if (acb_is_finite(t) && acb_is_real(t))
-        arb_swap(res, acb_realref(t));
-    else
-        arb_indeterminate(res);
-    acb_clear(t);
-    acb_clear(u);
-}
-
 void
 arb_hypgeom_bessel_y(arb_t res, const arb_t nu, const arb_t z, slong prec)
 {
@@ -356,40 +268,6 @@ arb_hypgeom_bessel_jy(arb_t res1, arb_t res2, const arb_t nu, const arb_t z, slo
     acb_clear(u);
 }
 
-void
-arb_hypgeom_bessel_i(arb_t res, const arb_t nu, const arb_t z, slong prec)
-{
-    acb_t t, u;
-    acb_init(t);
-    acb_init(u);
-    arb_set(acb_realref(t), nu);
-    arb_set(acb_realref(u), z);
-    acb_hypgeom_bessel_i(t, t, u, prec);
-    if (acb_is_finite(t) && acb_is_real(t))
-        arb_swap(res, acb_realref(t));
-    else
-        arb_indeterminate(res);
-    acb_clear(t);
-    acb_clear(u);
-}
-
-void
-arb_hypgeom_bessel_i_scaled(arb_t res, const arb_t nu, const arb_t z, slong prec)
-{
-    acb_t t, u;
-    acb_init(t);
-    acb_init(u);
-    arb_set(acb_realref(t), nu);
-    arb_set(acb_realref(u), z);
-    acb_hypgeom_bessel_i_scaled(t, t, u, prec);
-    if (acb_is_finite(t) && acb_is_real(t))
-        arb_swap(res, acb_realref(t));
-    else
-        arb_indeterminate(res);
-    acb_clear(t);
-    acb_clear(u);
-}
-
 void
 arb_hypgeom_bessel_k(arb_t res, const arb_t nu, const arb_t z, slong prec)
 {
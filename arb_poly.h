@@ -349,6 +349,9 @@ void _arb_poly_tree_free(arb_ptr * tree, slong len);
 
 void _arb_poly_tree_build(arb_ptr * tree, arb_srcptr roots, slong len, slong prec);
 
+void _arb_poly_tree_build_threaded(arb_ptr * tree, arb_srcptr roots,
+    slong len, slong prec);
+
 /* Composition */
 
 void _arb_poly_taylor_shift_horner(arb_ptr poly, const arb_t c, slong n, slong prec);
@@ -363,6 +366,13 @@ void _arb_poly_taylor_shift_convolution(arb_ptr poly, const arb_t c, slong n, sl
 
 void arb_poly_taylor_shift_convolution(arb_poly_t g, const arb_poly_t f, const arb_t c, slong prec);
 
+void _arb_poly_taylor_shift_threaded(arb_ptr poly, const arb_t c, slong n, slong prec);
+
+void arb_poly_taylor_shift_threaded(arb_poly_t g, const arb_poly_t f, const arb_t c, slong prec);
+
+ARB_DLL extern slong arb_poly_taylor_shift_horner_cutoff;
+ARB_DLL extern slong arb_poly_taylor_shift_threaded_cutoff;
+
 void _arb_poly_taylor_shift(arb_ptr poly, const arb_t c, slong n, slong prec);
 
 void arb_poly_taylor_shift(arb_poly_t g, const arb_poly_t f, const arb_t c, slong prec);
@@ -424,6 +434,11 @@ void arb_poly_evaluate_horner(arb_t res, const arb_poly_t f, const arb_t a, slon
 void _arb_poly_evaluate_rectangular(arb_t y, arb_srcptr poly, slong len, const arb_t x, slong prec);
 void arb_poly_evaluate_rectangular(arb_t res, const arb_poly_t f, const arb_t a, slong prec);
 
+void _arb_poly_evaluate_rectangular_multi(arb_ptr ys, arb_srcptr * polys,
+    const slong * lens, slong num, const arb_t x, slong prec);
+void arb_poly_evaluate_multi(arb_ptr ys, const arb_poly_struct * polys,
+    slong num, const arb_t x, slong prec);
+
 void _arb_poly_evaluate(arb_t res, arb_srcptr f, slong len, const arb_t a, slong prec);
 void arb_poly_evaluate(arb_t res, const arb_poly_t f, const arb_t a, slong prec);
 
@@ -454,6 +469,15 @@ void _arb_poly_evaluate_vec_fast(arb_ptr ys, arb_srcptr poly, slong plen,
 void arb_poly_evaluate_vec_fast(arb_ptr ys,
         const arb_poly_t poly, arb_srcptr xs, slong n, slong prec);
 
+void _arb_poly_evaluate_vec_fast_precomp_threaded(arb_ptr vs, arb_srcptr poly,
+    slong plen, arb_ptr * tree, slong len, slong prec);
+
+void _arb_poly_evaluate_vec_fast_precomp_multi(arb_ptr ys, arb_srcptr * polys,
+    const slong * plens, slong num, arb_ptr * tree, slong len, slong prec);
+
+void arb_poly_evaluate_vec_fast_multi(arb_ptr ys, const arb_poly_struct * polys,
+    slong num, arb_srcptr xs, slong n, slong prec);
+
 void _arb_poly_interpolate_newton(arb_ptr poly, arb_srcptr xs,
     arb_srcptr ys, slong n, slong prec);
 
@@ -474,6 +498,10 @@ void _arb_poly_interpolate_fast_precomp(arb_ptr poly,
     arb_srcptr ys, arb_ptr * tree, arb_srcptr weights,
     slong len, slong prec);
 
+void _arb_poly_interpolate_fast_precomp_threaded(arb_ptr poly,
+    arb_srcptr ys, arb_ptr * tree, arb_srcptr weights,
+    slong len, slong prec);
+
 void _arb_poly_interpolate_fast(arb_ptr poly,
     arb_srcptr xs, arb_srcptr ys, slong len, slong prec);
 
@@ -47,7 +47,18 @@ _arb_poly_compose_series_brent_kung(arb_ptr res,
     for (i = 2; i < m; i++)
         _arb_poly_mullow(A->rows[i], A->rows[(i + 1) / 2], n, A->rows[i / 2], n, n, prec);
 
-    arb_mat_mul(C, B, A, prec);
+    /* The product is m x m times m x n with n ~ m^2. The generic
+       arb_mat_mul only switches to block multiplication based on the
+       smallest dimension; here the conversion cost is amortized over
+       the n columns, and the per-column scaling in the block algorithm
+       matches the geometric decay of the coefficients. At very high
+       precision, block multiplication loses to classical multiplication,
+       and with several threads arb_mat_mul is the version that threads,
+       so these cases are left to the default dispatch. */
+    if (m >= 16 && prec < 8000 && flint_get_num_threads() == 1)
+        arb_mat_mul_block(C, B, A, prec);
+    else
+        arb_mat_mul(C, B, A, prec);
 
     /* Evaluate block composition using the Horner scheme */
     _arb_vec_set(res, C->rows[m - 1], n);
@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+void
+_arb_poly_evaluate_rectangular_multi(arb_ptr ys, arb_srcptr * polys,
+    const slong * lens, slong num, const arb_t x, slong prec)
+{
+    slong i, k, m, r, len, maxlen;
+    arb_srcptr poly;
+    arb_ptr xs;
+    arb_t s;
+
+    maxlen = 0;
+    for (k = 0; k < num; k++)
+        maxlen = FLINT_MAX(maxlen, lens[k]);
+
+    if (maxlen < 3)
+    {
+        for (k = 0; k < num; k++)
+            _arb_poly_evaluate_rectangular(ys + k, polys[k], lens[k], x, prec);
+        return;
+    }
+
+    /* one table of powers x, ..., x^m shared by all polynomials */
+    m = n_sqrt(maxlen) + 1;
+
+    xs = _arb_vec_init(m + 1);
+    arb_init(s);
+
+    _arb_vec_set_powers(xs, x, m + 1, prec);
+
+    for (k = 0; k < num; k++)
+    {
+        poly = polys[k];
+        len = lens[k];
+
+        if (len < 3)
+        {
+            if (len == 0)
+            {
+                arb_zero(ys + k);
+            }
+            else if (len == 1)
+            {
+                arb_set_round(ys + k, poly + 0, prec);
+            }
+            else
+            {
+                arb_mul(ys + k, xs + 1, poly + 1, prec);
+                arb_add(ys + k, ys + k, poly + 0, prec);
+            }
+            continue;
+        }
+
+        r = (len + m - 1) / m;
+
+        arb_dot(ys + k, poly + (r - 1) * m, 0, xs + 1, 1,
+            poly + (r - 1) * m + 1, 1, len - (r - 1) * m - 1, prec);
+
+        for (i = r - 2; i >= 0; i--)
+        {
+            arb_dot(s, poly + i * m, 0, xs + 1, 1,
+                poly + i * m + 1, 1, m - 1, prec);
+            arb_mul(ys + k, ys + k, xs + m, prec);
+            arb_add(ys + k, ys + k, s, prec);
+        }
+    }
+
+    _arb_vec_clear(xs, m + 1);
+    arb_clear(s);
+}
+
+void
+arb_poly_evaluate_multi(arb_ptr ys, const arb_poly_struct * polys,
+    slong num, const arb_t x, slong prec)
+{
+    arb_srcptr * ptrs;
+    slong * lens;
+    slong k;
+
+    if (num == 0)
+        return;
+
+    ptrs = flint_malloc(sizeof(arb_srcptr) * num);
+    lens = flint_malloc(sizeof(slong) * num);
+
+    for (k = 0; k < num; k++)
+    {
+        ptrs[k] = polys[k].coeffs;
+        lens[k] = polys[k].length;
+    }
+
+    _arb_poly_evaluate_rectangular_multi(ys, ptrs, lens, num, x, prec);
+
+    flint_free(ptrs);
+    flint_free(lens);
+}
@@ -121,8 +121,18 @@ void _arb_poly_evaluate_vec_fast(arb_ptr ys, arb_srcptr poly, slong plen,
     arb_ptr * tree;
 
     tree = _arb_poly_tree_alloc(n);
-    _arb_poly_tree_build(tree, xs, n, prec);
-    _arb_poly_evaluate_vec_fast_precomp(ys, poly, plen, tree, n, prec);
+
+    if (flint_get_num_threads() > 1 && n >= 64 && (double) n * prec >= 16384)
+    {
+        _arb_poly_tree_build_threaded(tree, xs, n, prec);
+        _arb_poly_evaluate_vec_fast_precomp_threaded(ys, poly, plen, tree, n, prec);
+    }
+    else
+    {
+        _arb_poly_tree_build(tree, xs, n, prec);
+        _arb_poly_evaluate_vec_fast_precomp(ys, poly, plen, tree, n, prec);
+    }
+
     _arb_poly_tree_free(tree, n);
 }
 
@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "arb_poly.h"
+
+typedef struct
+{
+    arb_ptr ys;
+    arb_srcptr * polys;
+    const slong * plens;
+    arb_ptr * tree;
+    slong len;
+    slong k0;
+    slong k1;
+    slong prec;
+}
+multi_arg_t;
+
+static void *
+multi_worker(void * arg_ptr)
+{
+    multi_arg_t arg = *((multi_arg_t *) arg_ptr);
+    slong k;
+
+    for (k = arg.k0; k < arg.k1; k++)
+        _arb_poly_evaluate_vec_fast_precomp(arg.ys + k * arg.len,
+            arg.polys[k], arg.plens[k], arg.tree, arg.len, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_arb_poly_evaluate_vec_fast_precomp_multi(arb_ptr ys, arb_srcptr * polys,
+    const slong * plens, slong num, arb_ptr * tree, slong len, slong prec)
+{
+    slong i, num_threads;
+    pthread_t * threads;
+    multi_arg_t * args;
+
+    num_threads = flint_get_num_threads();
+
+    /* with few polynomials, parallelize each remainder tree instead */
+    if (num_threads <= 1 || num < num_threads)
+    {
+        for (i = 0; i < num; i++)
+            _arb_poly_evaluate_vec_fast_precomp_threaded(ys + i * len,
+                polys[i], plens[i], tree, len, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(multi_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].ys = ys;
+        args[i].polys = polys;
+        args[i].plens = plens;
+        args[i].tree = tree;
+        args[i].len = len;
+        args[i].k0 = (num * i) / num_threads;
+        args[i].k1 = (num * (i + 1)) / num_threads;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, multi_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void
+arb_poly_evaluate_vec_fast_multi(arb_ptr ys, const arb_poly_struct * polys,
+    slong num, arb_srcptr xs, slong n, slong prec)
+{
+    arb_ptr * tree;
+    arb_srcptr * ptrs;
+    slong * lens;
+    slong i;
+
+    if (n == 0 || num == 0)
+        return;
+
+    ptrs = flint_malloc(sizeof(arb_srcptr) * num);
+    lens = flint_malloc(sizeof(slong) * num);
+
+    for (i = 0; i < num; i++)
+    {
+        ptrs[i] = polys[i].coeffs;
+        lens[i] = polys[i].length;
+    }
+
+    tree = _arb_poly_tree_alloc(n);
+    _arb_poly_tree_build_threaded(tree, xs, n, prec);
+    _arb_poly_evaluate_vec_fast_precomp_multi(ys, ptrs, lens, num, tree, n, prec);
+    _arb_poly_tree_free(tree, n);
+
+    flint_free(ptrs);
+    flint_free(lens);
+}
@@ -35,7 +35,11 @@ _arb_poly_interpolation_weights(arb_ptr w,
                         tree[height-1] + (n + 1), (len - n + 1), prec);
 
     _arb_poly_derivative(tmp, tmp, len + 1, prec);
-    _arb_poly_evaluate_vec_fast_precomp(w, tmp, len, tree, len, prec);
+
+    if (flint_get_num_threads() > 1 && len >= 64 && (double) len * prec >= 16384)
+        _arb_poly_evaluate_vec_fast_precomp_threaded(w, tmp, len, tree, len, prec);
+    else
+        _arb_poly_evaluate_vec_fast_precomp(w, tmp, len, tree, len, prec);
 
     for (i = 0; i < len; i++)
         arb_inv(w + i, w + i, prec);
@@ -96,14 +100,25 @@ _arb_poly_interpolate_fast(arb_ptr poly,
 {
     arb_ptr * tree;
     arb_ptr w;
+    int threaded;
+
+    threaded = flint_get_num_threads() > 1 && len >= 64 &&
+        (double) len * prec >= 16384;
 
     tree = _arb_poly_tree_alloc(len);
-    _arb_poly_tree_build(tree, xs, len, prec);
+
+    if (threaded)
+        _arb_poly_tree_build_threaded(tree, xs, len, prec);
+    else
+        _arb_poly_tree_build(tree, xs, len, prec);
 
     w = _arb_vec_init(len);
     _arb_poly_interpolation_weights(w, tree, len, prec);
 
-    _arb_poly_interpolate_fast_precomp(poly, ys, tree, w, len, prec);
+    if (threaded)
+        _arb_poly_interpolate_fast_precomp_threaded(poly, ys, tree, w, len, prec);
+    else
+        _arb_poly_interpolate_fast_precomp(poly, ys, tree, w, len, prec);
 
     _arb_vec_clear(w, len);
     _arb_poly_tree_free(tree, len);
@@ -0,0 +1,120 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "arb_poly.h"
+
+typedef struct
+{
+    arb_ptr poly;
+    arb_srcptr pa;
+    slong pow;
+    slong b0;
+    slong b1;
+    slong prec;
+}
+interpolate_arg_t;
+
+static void *
+interpolate_worker(void * arg_ptr)
+{
+    interpolate_arg_t arg = *((interpolate_arg_t *) arg_ptr);
+    arb_ptr t, u, pb;
+    arb_srcptr pa;
+    slong b, pow;
+
+    pow = arg.pow;
+    t = _arb_vec_init(2 * pow);
+    u = _arb_vec_init(2 * pow);
+
+    for (b = arg.b0; b < arg.b1; b++)
+    {
+        pa = arg.pa + b * (2 * pow + 2);
+        pb = arg.poly + b * (2 * pow);
+
+        _arb_poly_mul(t, pa, pow + 1, pb + pow, pow, arg.prec);
+        _arb_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, arg.prec);
+        _arb_vec_add(pb, t, u, 2 * pow, arg.prec);
+    }
+
+    _arb_vec_clear(t, 2 * pow);
+    _arb_vec_clear(u, 2 * pow);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_arb_poly_interpolate_fast_precomp_threaded(arb_ptr poly,
+    arb_srcptr ys, arb_ptr * tree, arb_srcptr weights,
+    slong len, slong prec)
+{
+    arb_ptr t, u, pa, pb;
+    slong i, j, pow, left, num_blocks, num_threads, nt;
+    pthread_t * threads;
+    interpolate_arg_t * args;
+
+    num_threads = flint_get_num_threads();
+
+    if (len < 2 || num_threads <= 1)
+    {
+        _arb_poly_interpolate_fast_precomp(poly, ys, tree, weights, len, prec);
+        return;
+    }
+
+    t = _arb_vec_init(len);
+    u = _arb_vec_init(len);
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(interpolate_arg_t) * num_threads);
+
+    for (i = 0; i < len; i++)
+        arb_mul(poly + i, weights + i, ys + i, prec);
+
+    for (i = 0; i < FLINT_CLOG2(len); i++)
+    {
+        pow = (WORD(1) << i);
+        num_blocks = len / (2 * pow);
+        left = len - num_blocks * (2 * pow);
+        nt = FLINT_MIN(num_threads, num_blocks);
+
+        for (j = 0; j < nt; j++)
+        {
+            args[j].poly = poly;
+            args[j].pa = tree[i];
+            args[j].pow = pow;
+            args[j].b0 = (num_blocks * j) / nt;
+            args[j].b1 = (num_blocks * (j + 1)) / nt;
+            args[j].prec = prec;
+
+            pthread_create(&threads[j], NULL, interpolate_worker, &args[j]);
+        }
+
+        pa = tree[i] + num_blocks * (2 * pow + 2);
+        pb = poly + num_blocks * (2 * pow);
+
+        if (left > pow)
+        {
+            _arb_poly_mul(t, pa, pow + 1, pb + pow, left - pow, prec);
+            _arb_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, prec);
+            _arb_vec_add(pb, t, u, left, prec);
+        }
+
+        for (j = 0; j < nt; j++)
+            pthread_join(threads[j], NULL);
+    }
+
+    _arb_vec_clear(t, len);
+    _arb_vec_clear(u, len);
+
+    flint_free(threads);
+    flint_free(args);
+}
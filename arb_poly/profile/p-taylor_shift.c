@@ -0,0 +1,124 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "arb_poly.h"
+#include "flint/profiler.h"
+
+/*
+    Times the Taylor shift algorithms against each other and prints
+    suggested values for arb_poly_taylor_shift_horner_cutoff and
+    arb_poly_taylor_shift_threaded_cutoff on this machine.
+
+    usage: p-taylor_shift [num_threads]
+*/
+
+typedef void (*shift_func_t)(arb_ptr, const arb_t, slong, slong);
+
+static double
+time_shift(shift_func_t func, arb_srcptr poly, const arb_t c, slong n, slong prec)
+{
+    timeit_t timer;
+    arb_ptr v;
+    slong i, reps;
+
+    v = _arb_vec_init(n);
+
+    for (reps = 1; ; reps *= 2)
+    {
+        timeit_start(timer);
+        for (i = 0; i < reps; i++)
+        {
+            _arb_vec_set(v, poly, n);
+            func(v, c, n, prec);
+        }
+        timeit_stop(timer);
+
+        if (timer->wall >= 50)
+            break;
+    }
+
+    _arb_vec_clear(v, n);
+
+    return (double) timer->wall / reps;
+}
+
+int main(int argc, char *argv[])
+{
+    slong prec_tab[4] = { 64, 256, 1024, 4096 };
+    slong i, j, n, prec, num_threads, horner_cutoff, threaded_cutoff;
+    double t_horner, t_divconquer, t_convolution, t_threaded, t_best;
+    flint_rand_t state;
+    arb_ptr poly;
+    arb_t c;
+
+    num_threads = (argc > 1) ? atol(argv[1]) : 1;
+    flint_set_num_threads(num_threads);
+
+    flint_randinit(state);
+    arb_init(c);
+
+    arb_set_str(c, "0.3183098861837906715377675", 256);
+
+    horner_cutoff = WORD_MAX;
+    threaded_cutoff = WORD_MAX;
+
+    for (j = 0; j < 4; j++)
+    {
+        prec = prec_tab[j];
+
+        flint_printf("prec = %wd\n", prec);
+        flint_printf("%8s %12s %12s %12s %12s\n", "n",
+            "horner", "divconquer", "convolution", "threaded");
+
+        for (n = 8; n <= 16384; n *= 2)
+        {
+            poly = _arb_vec_init(n);
+
+            for (i = 0; i < n; i++)
+                arb_randtest(poly + i, state, prec, 4);
+
+            t_horner = (n <= 2048) ?
+                time_shift(_arb_poly_taylor_shift_horner, poly, c, n, prec) : 1e300;
+            t_divconquer = time_shift(_arb_poly_taylor_shift_divconquer, poly, c, n, prec);
+            t_convolution = time_shift(_arb_poly_taylor_shift_convolution, poly, c, n, prec);
+            t_threaded = (num_threads > 1) ?
+                time_shift(_arb_poly_taylor_shift_threaded, poly, c, n, prec) : 1e300;
+
+            flint_printf("%8wd %12g %12g %12g %12g\n", n,
+                t_horner, t_divconquer, t_convolution, t_threaded);
+
+            t_best = FLINT_MIN(t_divconquer, t_convolution);
+
+            if (t_horner > t_best && n / 2 < horner_cutoff)
+                horner_cutoff = n / 2;
+
+            if (t_threaded < FLINT_MIN(t_best, t_horner) && n < threaded_cutoff)
+                threaded_cutoff = n;
+
+            _arb_vec_clear(poly, n);
+        }
+
+        flint_printf("\n");
+    }
+
+    flint_printf("suggested arb_poly_taylor_shift_horner_cutoff = %wd\n",
+        (horner_cutoff == WORD_MAX) ? 2048 : horner_cutoff);
+
+    if (num_threads > 1)
+        flint_printf("suggested arb_poly_taylor_shift_threaded_cutoff = %wd\n",
+            threaded_cutoff);
+
+    arb_clear(c);
+    flint_randclear(state);
+    flint_cleanup();
+    return EXIT_SUCCESS;
+}
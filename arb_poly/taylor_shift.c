@@ -11,14 +11,26 @@
 
 #include "arb_poly.h"
 
+/* Algorithm crossovers. The Horner cutoff is the historical default;
+   the threaded cutoff is a conservative guess. Both can be adjusted to
+   measurements on the host (see arb_poly/profile/p-taylor_shift.c). */
+ARB_DLL slong arb_poly_taylor_shift_horner_cutoff = 30;
+ARB_DLL slong arb_poly_taylor_shift_threaded_cutoff = 1000;
+
 void
 _arb_poly_taylor_shift(arb_ptr poly, const arb_t c, slong n, slong prec)
 {
-    if (n <= 30 || (n <= 500 && arb_bits(c) == 1 && n < 30 + 3 * sqrt(prec))
-                || (n <= 100 && arb_bits(c) < 0.01 * prec))
+    slong cutoff = arb_poly_taylor_shift_horner_cutoff;
+
+    if (n <= cutoff || (n <= 500 && arb_bits(c) == 1 && n < cutoff + 3 * sqrt(prec))
+                    || (n <= 100 && arb_bits(c) < 0.01 * prec))
     {
         _arb_poly_taylor_shift_horner(poly, c, n, prec);
     }
+    else if (n >= arb_poly_taylor_shift_threaded_cutoff && flint_get_num_threads() > 1)
+    {
+        _arb_poly_taylor_shift_threaded(poly, c, n, prec);
+    }
     else if (prec > 2 * n)
     {
         _arb_poly_taylor_shift_convolution(poly, c, n, prec);
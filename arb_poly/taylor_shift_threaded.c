@@ -0,0 +1,138 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "arb_poly.h"
+
+typedef struct
+{
+    arb_ptr poly;
+    arb_srcptr c;
+    slong len;
+    slong prec;
+    slong num_threads;
+}
+taylor_shift_arg_t;
+
+static void
+_arb_poly_taylor_shift_leaf(arb_ptr poly, const arb_t c, slong len, slong prec)
+{
+    if (len <= arb_poly_taylor_shift_horner_cutoff)
+        _arb_poly_taylor_shift_horner(poly, c, len, prec);
+    else if (prec > 2 * len)
+        _arb_poly_taylor_shift_convolution(poly, c, len, prec);
+    else
+        _arb_poly_taylor_shift_divconquer(poly, c, len, prec);
+}
+
+/* res = (x+c)^m */
+static void
+_arb_poly_binomial_power(arb_ptr res, const arb_t c, slong m, slong prec)
+{
+    fmpz_t b;
+    slong k;
+
+    _arb_vec_set_powers(res, c, m + 1, prec);
+    _arb_poly_reverse(res, res, m + 1, m + 1);
+
+    fmpz_init(b);
+    fmpz_one(b);
+
+    for (k = 1; k < m; k++)
+    {
+        fmpz_mul_ui(b, b, m - k + 1);
+        fmpz_divexact_ui(b, b, k);
+        arb_mul_fmpz(res + k, res + k, b, prec);
+    }
+
+    fmpz_clear(b);
+}
+
+static void _arb_poly_taylor_shift_rec(arb_ptr poly, const arb_t c,
+    slong len, slong prec, slong num_threads);
+
+static void *
+taylor_shift_worker(void * arg_ptr)
+{
+    taylor_shift_arg_t arg = *((taylor_shift_arg_t *) arg_ptr);
+    _arb_poly_taylor_shift_rec(arg.poly, arg.c, arg.len, arg.prec,
+        arg.num_threads);
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Writing f = f_0 + x^m f_1, we have
+    f(x+c) = f_0(x+c) + (x+c)^m f_1(x+c). The two shifts are done in
+    parallel (recursively, splitting the available threads), and the
+    calling thread computes (x+c)^m while waiting for f_1(x+c).
+*/
+static void
+_arb_poly_taylor_shift_rec(arb_ptr poly, const arb_t c,
+    slong len, slong prec, slong num_threads)
+{
+    taylor_shift_arg_t arg;
+    pthread_t thread;
+    arb_ptr t, u;
+    slong m;
+
+    if (num_threads <= 1 || len <= 64)
+    {
+        _arb_poly_taylor_shift_leaf(poly, c, len, prec);
+        return;
+    }
+
+    m = len / 2;
+
+    arg.poly = poly + m;
+    arg.c = c;
+    arg.len = len - m;
+    arg.prec = prec;
+    arg.num_threads = num_threads - num_threads / 2;
+
+    pthread_create(&thread, NULL, taylor_shift_worker, &arg);
+
+    _arb_poly_taylor_shift_rec(poly, c, m, prec, num_threads / 2);
+
+    t = _arb_vec_init(len);
+    u = _arb_vec_init(m + 1);
+
+    _arb_poly_binomial_power(u, c, m, prec);
+
+    pthread_join(thread, NULL);
+
+    /* m + 1 >= len - m */
+    _arb_poly_mul(t, u, m + 1, poly + m, len - m, prec);
+    _arb_vec_add(t, t, poly, m, prec);
+    _arb_vec_swap(poly, t, len);
+
+    _arb_vec_clear(t, len);
+    _arb_vec_clear(u, m + 1);
+}
+
+void
+_arb_poly_taylor_shift_threaded(arb_ptr poly, const arb_t c, slong n, slong prec)
+{
+    if (n <= 1 || arb_is_zero(c))
+        return;
+
+    _arb_poly_taylor_shift_rec(poly, c, n, prec, flint_get_num_threads());
+}
+
+void
+arb_poly_taylor_shift_threaded(arb_poly_t g, const arb_poly_t f,
+    const arb_t c, slong prec)
+{
+    if (f != g)
+        arb_poly_set_round(g, f, prec);
+
+    _arb_poly_taylor_shift_threaded(g->coeffs, c, g->length, prec);
+}
@@ -35,6 +35,14 @@ int main()
         rbits3 = 2 + n_randint(state, 200);
         n = 2 + n_randint(state, 25);
 
+        /* occasionally exercise the block matrix multiplication */
+        if (n_randint(state, 100) == 0)
+        {
+            qbits1 = 2 + n_randint(state, 20);
+            qbits2 = 2 + n_randint(state, 20);
+            n = 256 + n_randint(state, 100);
+        }
+
         fmpq_poly_init(A);
         fmpq_poly_init(B);
         fmpq_poly_init(C);
@@ -44,8 +52,8 @@ int main()
         arb_poly_init(c);
         arb_poly_init(d);
 
-        fmpq_poly_randtest(A, state, 1 + n_randint(state, 25), qbits1);
-        fmpq_poly_randtest(B, state, 1 + n_randint(state, 25), qbits2);
+        fmpq_poly_randtest(A, state, 1 + n_randint(state, FLINT_MAX(25, n)), qbits1);
+        fmpq_poly_randtest(B, state, 1 + n_randint(state, FLINT_MAX(25, n)), qbits2);
         fmpq_poly_set_coeff_ui(B, 0, 0);
         fmpq_poly_compose_series(C, A, B, n);
 
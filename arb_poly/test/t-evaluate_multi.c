@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("evaluate_multi....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 5000 * arb_test_multiplier(); iter++)
+    {
+        arb_poly_struct * f;
+        arb_ptr y1;
+        arb_t x, y2;
+        slong k, num, prec;
+
+        num = n_randint(state, 8);
+        prec = 2 + n_randint(state, 1000);
+
+        f = flint_malloc(sizeof(arb_poly_struct) * num);
+        y1 = _arb_vec_init(num);
+        arb_init(x);
+        arb_init(y2);
+
+        for (k = 0; k < num; k++)
+        {
+            arb_poly_init(f + k);
+            arb_poly_randtest(f + k, state, n_randint(state, 100),
+                2 + n_randint(state, 1000), 5);
+        }
+
+        arb_randtest(x, state, 2 + n_randint(state, 1000), 5);
+
+        arb_poly_evaluate_multi(y1, f, num, x, prec);
+
+        for (k = 0; k < num; k++)
+        {
+            arb_poly_evaluate_horner(y2, f + k, x, 2 + n_randint(state, 1000));
+
+            if (!arb_overlaps(y1 + k, y2))
+            {
+                flint_printf("FAIL (%wd of %wd)\n\n", k, num);
+                flint_printf("f = "); arb_poly_printd(f + k, 15); flint_printf("\n\n");
+                flint_printf("x = "); arb_printd(x, 15); flint_printf("\n\n");
+                flint_printf("y1 = "); arb_printd(y1 + k, 15); flint_printf("\n\n");
+                flint_printf("y2 = "); arb_printd(y2, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        for (k = 0; k < num; k++)
+            arb_poly_clear(f + k);
+        flint_free(f);
+        _arb_vec_clear(y1, num);
+        arb_clear(x);
+        arb_clear(y2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+static int
+vec_equal(arb_srcptr a, arb_srcptr b, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        if (!arb_equal(a + i, b + i))
+            return 0;
+
+    return 1;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("evaluate_vec_fast_multi....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        slong i, j, n, num, prec;
+        arb_poly_struct * f;
+        arb_ptr x, y, z;
+
+        flint_set_num_threads(1 + n_randint(state, 5));
+
+        n = n_randint(state, 30);
+        num = n_randint(state, 10);
+        prec = 2 + n_randint(state, 200);
+
+        f = flint_malloc(sizeof(arb_poly_struct) * num);
+        for (j = 0; j < num; j++)
+        {
+            arb_poly_init(f + j);
+            arb_poly_randtest(f + j, state, n_randint(state, 40),
+                1 + n_randint(state, 200), 10);
+        }
+
+        x = _arb_vec_init(n);
+        y = _arb_vec_init(n * num);
+        z = _arb_vec_init(n);
+
+        for (i = 0; i < n; i++)
+            arb_randtest(x + i, state, 1 + n_randint(state, 200), 10);
+
+        arb_poly_evaluate_vec_fast_multi(y, f, num, x, n, prec);
+
+        for (j = 0; j < num; j++)
+        {
+            arb_poly_evaluate_vec_fast(z, f + j, x, n, prec);
+
+            if (!vec_equal(y + j * n, z, n))
+            {
+                flint_printf("FAIL (%wd of %wd)\n\n", j, num);
+                flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+                flint_printf("f = "); arb_poly_printd(f + j, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        for (j = 0; j < num; j++)
+            arb_poly_clear(f + j);
+        flint_free(f);
+
+        _arb_vec_clear(x, n);
+        _arb_vec_clear(y, n * num);
+        _arb_vec_clear(z, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
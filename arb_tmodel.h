@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ARB_TMODEL_H
+#define ARB_TMODEL_H
+
+#ifdef ARB_TMODEL_INLINES_C
+#define ARB_TMODEL_INLINE
+#else
+#define ARB_TMODEL_INLINE static __inline__
+#endif
+
+#include <stdio.h>
+#include "arb.h"
+#include "arb_poly.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    A Taylor model represents a function f on the domain [m - r, m + r]
+    by a polynomial P and a remainder bound e such that
+    |f(x) - P(x - m)| <= e for all x in the domain. The domain is stored
+    as an arb_t whose midpoint is m and whose radius r is taken to be exact.
+*/
+typedef struct
+{
+    arb_poly_struct poly;
+    mag_struct err;
+    arb_struct dom;
+}
+arb_tmodel_struct;
+
+typedef arb_tmodel_struct arb_tmodel_t[1];
+typedef arb_tmodel_struct * arb_tmodel_ptr;
+typedef const arb_tmodel_struct * arb_tmodel_srcptr;
+
+#define arb_tmodel_polyref(M) (&(M)->poly)
+#define arb_tmodel_errref(M) (&(M)->err)
+#define arb_tmodel_domref(M) (&(M)->dom)
+
+typedef void (*arb_tmodel_series_func_t)(arb_ptr res,
+    arb_srcptr h, slong hlen, slong n, slong prec);
+
+/* Memory management and basic manipulation */
+
+void arb_tmodel_init(arb_tmodel_t M);
+
+void arb_tmodel_clear(arb_tmodel_t M);
+
+ARB_TMODEL_INLINE void
+arb_tmodel_swap(arb_tmodel_t A, arb_tmodel_t B)
+{
+    arb_tmodel_struct t = *A;
+    *A = *B;
+    *B = t;
+}
+
+void arb_tmodel_set(arb_tmodel_t res, const arb_tmodel_t M);
+
+void arb_tmodel_set_arb(arb_tmodel_t M, const arb_t c, const arb_t dom);
+
+void arb_tmodel_set_var(arb_tmodel_t M, const arb_t dom);
+
+void arb_tmodel_set_poly(arb_tmodel_t M, const arb_poly_t f,
+    const arb_t dom, slong n, slong prec);
+
+ARB_TMODEL_INLINE int
+arb_tmodel_same_domain(const arb_tmodel_t A, const arb_tmodel_t B)
+{
+    return arb_equal(arb_tmodel_domref(A), arb_tmodel_domref(B));
+}
+
+void arb_tmodel_fprintd(FILE * file, const arb_tmodel_t M, slong digits);
+
+ARB_TMODEL_INLINE void
+arb_tmodel_printd(const arb_tmodel_t M, slong digits)
+{
+    arb_tmodel_fprintd(stdout, M, digits);
+}
+
+/* Bounds */
+
+void _arb_tmodel_poly_bound(mag_t res, arb_srcptr poly, slong len,
+    const mag_t r);
+
+void arb_tmodel_truncate(arb_tmodel_t res, const arb_tmodel_t M, slong n);
+
+void arb_tmodel_bound(arb_t res, const arb_tmodel_t M, slong prec);
+
+void arb_tmodel_evaluate(arb_t res, const arb_tmodel_t M,
+    const arb_t x, slong prec);
+
+/* Arithmetic */
+
+void arb_tmodel_neg(arb_tmodel_t res, const arb_tmodel_t M);
+
+void arb_tmodel_add(arb_tmodel_t res, const arb_tmodel_t A,
+    const arb_tmodel_t B, slong prec);
+
+void arb_tmodel_sub(arb_tmodel_t res, const arb_tmodel_t A,
+    const arb_tmodel_t B, slong prec);
+
+void arb_tmodel_add_arb(arb_tmodel_t res, const arb_tmodel_t M,
+    const arb_t c, slong prec);
+
+void arb_tmodel_scalar_mul(arb_tmodel_t res, const arb_tmodel_t M,
+    const arb_t c, slong prec);
+
+void arb_tmodel_mul(arb_tmodel_t res, const arb_tmodel_t A,
+    const arb_tmodel_t B, slong n, slong prec);
+
+void _arb_tmodel_compose_poly(arb_tmodel_t res, arb_srcptr poly, slong len,
+    const arb_tmodel_t U, slong n, slong prec);
+
+void arb_tmodel_compose(arb_tmodel_t res, const arb_tmodel_t F,
+    const arb_tmodel_t G, slong n, slong prec);
+
+/* Calculus */
+
+void arb_tmodel_integral(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec);
+
+void arb_tmodel_definite_integral(arb_t res, const arb_tmodel_t M, slong prec);
+
+/* Elementary functions */
+
+void arb_tmodel_apply(arb_tmodel_t res, const arb_tmodel_t M,
+    arb_tmodel_series_func_t func, slong n, slong prec);
+
+void arb_tmodel_exp(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec);
+
+void arb_tmodel_log(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec);
+
+void arb_tmodel_sin(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec);
+
+void arb_tmodel_cos(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec);
+
+void arb_tmodel_atan(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec);
+
+void arb_tmodel_sqrt(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec);
+
+void arb_tmodel_rsqrt(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec);
+
+void arb_tmodel_inv(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec);
+
+void arb_tmodel_div(arb_tmodel_t res, const arb_tmodel_t A,
+    const arb_tmodel_t B, slong n, slong prec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_add(arb_tmodel_t res, const arb_tmodel_t A,
+    const arb_tmodel_t B, slong prec)
+{
+    if (!arb_tmodel_same_domain(A, B))
+    {
+        flint_printf("arb_tmodel_add: incompatible domains\n");
+        flint_abort();
+    }
+
+    arb_poly_add(arb_tmodel_polyref(res),
+        arb_tmodel_polyref(A), arb_tmodel_polyref(B), prec);
+    mag_add(arb_tmodel_errref(res), arb_tmodel_errref(A), arb_tmodel_errref(B));
+    arb_set(arb_tmodel_domref(res), arb_tmodel_domref(A));
+}
+
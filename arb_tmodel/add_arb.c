@@ -0,0 +1,33 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_add_arb(arb_tmodel_t res, const arb_tmodel_t M,
+    const arb_t c, slong prec)
+{
+    arb_poly_struct * P;
+
+    arb_tmodel_set(res, M);
+    P = arb_tmodel_polyref(res);
+
+    if (P->length == 0)
+    {
+        arb_poly_set_arb(P, c);
+    }
+    else
+    {
+        arb_add(P->coeffs, P->coeffs, c, prec);
+        _arb_poly_normalise(P);
+    }
+}
+
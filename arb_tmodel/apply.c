@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_apply(arb_tmodel_t res, const arb_tmodel_t M,
+    arb_tmodel_series_func_t func, slong n, slong prec)
+{
+    const arb_poly_struct * P = arb_tmodel_polyref(M);
+    arb_tmodel_t U;
+    arb_ptr x, a, b;
+    arb_t c;
+    mag_t B, t;
+
+    n = FLINT_MAX(n, 0);
+
+    arb_tmodel_init(U);
+    arb_init(c);
+    mag_init(B);
+    mag_init(t);
+    x = _arb_vec_init(2);
+    a = _arb_vec_init(n + 1);
+    b = _arb_vec_init(n + 1);
+
+    /* M = c + U with c exact */
+    if (P->length != 0)
+        arf_set(arb_midref(c), arb_midref(P->coeffs));
+
+    arb_neg(c, c);
+    arb_tmodel_add_arb(U, M, c, prec);
+    arb_neg(c, c);
+
+    /* |U(x)| <= B on the domain */
+    _arb_tmodel_poly_bound(B, arb_tmodel_polyref(U)->coeffs,
+        arb_tmodel_polyref(U)->length, arb_radref(arb_tmodel_domref(U)));
+    mag_add(B, B, arb_tmodel_errref(U));
+
+    /* f(c + u) = sum_{k<n} a_k u^k + f^(n)(xi)/n! u^n with |xi - c| <= B */
+    arb_one(x + 1);
+
+    if (n >= 1)
+    {
+        arb_set(x, c);
+        func(a, x, FLINT_MIN(2, n), n, prec);
+    }
+
+    arb_set(x, c);
+    arb_add_error_mag(x, B);
+    func(b, x, FLINT_MIN(2, n + 1), n + 1, prec);
+
+    if (arb_is_finite(b + n))
+    {
+        arb_get_mag(t, b + n);
+        mag_pow_ui(B, B, n);
+        mag_mul(t, t, B);
+    }
+    else
+    {
+        mag_inf(t);
+    }
+
+    _arb_tmodel_compose_poly(res, a, n, U, n, prec);
+    mag_add(arb_tmodel_errref(res), arb_tmodel_errref(res), t);
+
+    arb_tmodel_clear(U);
+    arb_clear(c);
+    mag_clear(B);
+    mag_clear(t);
+    _arb_vec_clear(x, 2);
+    _arb_vec_clear(a, n + 1);
+    _arb_vec_clear(b, n + 1);
+}
+
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_bound(arb_t res, const arb_tmodel_t M, slong prec)
+{
+    const arb_poly_struct * P = arb_tmodel_polyref(M);
+    mag_t t;
+
+    mag_init(t);
+
+    if (P->length <= 1)
+    {
+        mag_zero(t);
+    }
+    else
+    {
+        _arb_tmodel_poly_bound(t, P->coeffs + 1, P->length - 1,
+            arb_radref(arb_tmodel_domref(M)));
+        mag_mul(t, t, arb_radref(arb_tmodel_domref(M)));
+    }
+
+    mag_add(t, t, arb_tmodel_errref(M));
+
+    if (P->length == 0)
+        arb_zero(res);
+    else
+        arb_set_round(res, P->coeffs, prec);
+
+    arb_add_error_mag(res, t);
+
+    mag_clear(t);
+}
+
@@ -0,0 +1,83 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+/* res = sum_k poly[k] U^k by Horner's rule; res must not alias U */
+void
+_arb_tmodel_compose_poly(arb_tmodel_t res, arb_srcptr poly, slong len,
+    const arb_tmodel_t U, slong n, slong prec)
+{
+    slong k;
+
+    arb_poly_zero(arb_tmodel_polyref(res));
+    mag_zero(arb_tmodel_errref(res));
+    arb_set(arb_tmodel_domref(res), arb_tmodel_domref(U));
+
+    if (len <= 0)
+        return;
+
+    arb_poly_set_arb(arb_tmodel_polyref(res), poly + len - 1);
+
+    for (k = len - 2; k >= 0; k--)
+    {
+        arb_tmodel_mul(res, res, U, n, prec);
+        arb_tmodel_add_arb(res, res, poly + k, prec);
+    }
+
+    arb_tmodel_truncate(res, res, n);
+}
+
+void
+arb_tmodel_compose(arb_tmodel_t res, const arb_tmodel_t F,
+    const arb_tmodel_t G, slong n, slong prec)
+{
+    arb_tmodel_t U, R;
+    arb_t b;
+    mag_t ferr;
+
+    arb_tmodel_init(U);
+    arb_tmodel_init(R);
+    arb_init(b);
+    mag_init(ferr);
+
+    mag_set(ferr, arb_tmodel_errref(F));
+
+    /* the range of G must lie inside the domain of F */
+    arb_tmodel_bound(b, G, prec);
+
+    if (!arb_contains(arb_tmodel_domref(F), b))
+    {
+        arb_poly_zero(arb_tmodel_polyref(R));
+        mag_inf(arb_tmodel_errref(R));
+        arb_set(arb_tmodel_domref(R), arb_tmodel_domref(G));
+    }
+    else
+    {
+        /* U = G - mid(dom(F)) */
+        arf_set(arb_midref(b), arb_midref(arb_tmodel_domref(F)));
+        mag_zero(arb_radref(b));
+        arb_neg(b, b);
+        arb_tmodel_add_arb(U, G, b, prec);
+
+        _arb_tmodel_compose_poly(R, arb_tmodel_polyref(F)->coeffs,
+            arb_tmodel_polyref(F)->length, U, n, prec);
+        mag_add(arb_tmodel_errref(R), arb_tmodel_errref(R), ferr);
+    }
+
+    arb_tmodel_swap(res, R);
+
+    arb_tmodel_clear(U);
+    arb_tmodel_clear(R);
+    arb_clear(b);
+    mag_clear(ferr);
+}
+
@@ -0,0 +1,57 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_definite_integral(arb_t res, const arb_tmodel_t M, slong prec)
+{
+    const arb_poly_struct * P = arb_tmodel_polyref(M);
+    arb_t r, r2, rk, t, s;
+    mag_t e;
+    slong k;
+
+    arb_init(r);
+    arb_init(r2);
+    arb_init(rk);
+    arb_init(t);
+    arb_init(s);
+    mag_init(e);
+
+    /* integral of t^k over [-r, r] is 2 r^(k+1) / (k+1) for even k */
+    arf_set_mag(arb_midref(r), arb_radref(arb_tmodel_domref(M)));
+    arb_mul(r2, r, r, prec);
+    arb_one(rk);
+
+    for (k = 0; k < P->length; k += 2)
+    {
+        arb_div_ui(t, P->coeffs + k, k + 1, prec);
+        arb_addmul(s, t, rk, prec);
+        arb_mul(rk, rk, r2, prec);
+    }
+
+    arb_mul(s, s, r, prec);
+    arb_mul_2exp_si(s, s, 1);
+
+    mag_mul(e, arb_tmodel_errref(M), arb_radref(arb_tmodel_domref(M)));
+    mag_mul_2exp_si(e, e, 1);
+    arb_add_error_mag(s, e);
+
+    arb_swap(res, s);
+
+    arb_clear(r);
+    arb_clear(r2);
+    arb_clear(rk);
+    arb_clear(t);
+    arb_clear(s);
+    mag_clear(e);
+}
+
@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_evaluate(arb_t res, const arb_tmodel_t M,
+    const arb_t x, slong prec)
+{
+    const arb_poly_struct * P = arb_tmodel_polyref(M);
+    arb_t t;
+
+    if (!arb_contains(arb_tmodel_domref(M), x))
+    {
+        arb_indeterminate(res);
+        return;
+    }
+
+    arb_init(t);
+
+    arb_sub_arf(t, x, arb_midref(arb_tmodel_domref(M)), prec);
+    _arb_poly_evaluate(res, P->coeffs, P->length, t, prec);
+    arb_add_error_mag(res, arb_tmodel_errref(M));
+
+    arb_clear(t);
+}
+
@@ -0,0 +1,19 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_exp(arb_tmodel_t res, const arb_tmodel_t M, slong n, slong prec)
+{
+    arb_tmodel_apply(res, M, _arb_poly_exp_series, n, prec);
+}
+
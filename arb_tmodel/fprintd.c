@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_fprintd(FILE * file, const arb_tmodel_t M, slong digits)
+{
+    arb_poly_fprintd(file, arb_tmodel_polyref(M), digits);
+    flint_fprintf(file, " +/- ");
+    mag_fprintd(file, arb_tmodel_errref(M), 5);
+    flint_fprintf(file, " on ");
+    arb_fprintd(file, arb_tmodel_domref(M), digits);
+}
+
@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_init(arb_tmodel_t M)
+{
+    arb_poly_init(arb_tmodel_polyref(M));
+    mag_init(arb_tmodel_errref(M));
+    arb_init(arb_tmodel_domref(M));
+}
+
+void
+arb_tmodel_clear(arb_tmodel_t M)
+{
+    arb_poly_clear(arb_tmodel_polyref(M));
+    mag_clear(arb_tmodel_errref(M));
+    arb_clear(arb_tmodel_domref(M));
+}
+
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_integral(arb_tmodel_t res, const arb_tmodel_t M,
+    slong n, slong prec)
+{
+    /* integral from m to x, with |x - m| <= r */
+    arb_poly_integral(arb_tmodel_polyref(res), arb_tmodel_polyref(M), prec);
+    mag_mul(arb_tmodel_errref(res), arb_tmodel_errref(M),
+        arb_radref(arb_tmodel_domref(M)));
+    arb_set(arb_tmodel_domref(res), arb_tmodel_domref(M));
+
+    arb_tmodel_truncate(res, res, n);
+}
+
@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_mul(arb_tmodel_t res, const arb_tmodel_t A,
+    const arb_tmodel_t B, slong n, slong prec)
+{
+    const arb_poly_struct * P = arb_tmodel_polyref(A);
+    const arb_poly_struct * Q = arb_tmodel_polyref(B);
+    const mag_struct * r = arb_radref(arb_tmodel_domref(A));
+    mag_t pb, qb, err, t;
+
+    if (!arb_tmodel_same_domain(A, B))
+    {
+        flint_printf("arb_tmodel_mul: incompatible domains\n");
+        flint_abort();
+    }
+
+    mag_init(pb);
+    mag_init(qb);
+    mag_init(err);
+    mag_init(t);
+
+    /* (P + e1)(Q + e2) = PQ + P e2 + Q e1 + e1 e2 */
+    _arb_tmodel_poly_bound(pb, P->coeffs, P->length, r);
+    _arb_tmodel_poly_bound(qb, Q->coeffs, Q->length, r);
+
+    mag_mul(err, pb, arb_tmodel_errref(B));
+    mag_mul(t, qb, arb_tmodel_errref(A));
+    mag_add(err, err, t);
+    mag_mul(t, arb_tmodel_errref(A), arb_tmodel_errref(B));
+    mag_add(err, err, t);
+
+    arb_set(arb_tmodel_domref(res), arb_tmodel_domref(A));
+    arb_poly_mul(arb_tmodel_polyref(res), P, Q, prec);
+    mag_swap(arb_tmodel_errref(res), err);
+
+    arb_tmodel_truncate(res, res, n);
+
+    mag_clear(pb);
+    mag_clear(qb);
+    mag_clear(err);
+    mag_clear(t);
+}
+
@@ -0,0 +1,40 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+/* bound sum |c_k| r^k by Horner's rule */
+void
+_arb_tmodel_poly_bound(mag_t res, arb_srcptr poly, slong len, const mag_t r)
+{
+    mag_t t;
+    slong k;
+
+    if (len <= 0)
+    {
+        mag_zero(res);
+        return;
+    }
+
+    mag_init(t);
+
+    arb_get_mag(res, poly + len - 1);
+
+    for (k = len - 2; k >= 0; k--)
+    {
+        mag_mul(res, res, r);
+        arb_get_mag(t, poly + k);
+        mag_add(res, res, t);
+    }
+
+    mag_clear(t);
+}
+
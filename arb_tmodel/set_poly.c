@@ -0,0 +1,30 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_set_poly(arb_tmodel_t M, const arb_poly_t f,
+    const arb_t dom, slong n, slong prec)
+{
+    arb_t m;
+
+    arb_init(m);
+    arf_set(arb_midref(m), arb_midref(dom));
+
+    arb_set(arb_tmodel_domref(M), dom);
+    mag_zero(arb_tmodel_errref(M));
+    arb_poly_taylor_shift(arb_tmodel_polyref(M), f, m, prec);
+    arb_tmodel_truncate(M, M, n);
+
+    arb_clear(m);
+}
+
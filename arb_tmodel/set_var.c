@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_set_var(arb_tmodel_t M, const arb_t dom)
+{
+    arb_poly_struct * P = arb_tmodel_polyref(M);
+
+    arb_set(arb_tmodel_domref(M), dom);
+    mag_zero(arb_tmodel_errref(M));
+
+    /* x = m + t */
+    arb_poly_fit_length(P, 2);
+    arf_set(arb_midref(P->coeffs), arb_midref(dom));
+    mag_zero(arb_radref(P->coeffs));
+    arb_one(P->coeffs + 1);
+    _arb_poly_set_length(P, 2);
+}
+
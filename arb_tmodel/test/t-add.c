@@ -0,0 +1,149 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+static void
+_random_domain(arb_t dom, flint_rand_t state)
+{
+    arf_randtest(arb_midref(dom), state, 1 + n_randint(state, 100), 3);
+    mag_set_ui_2exp_si(arb_radref(dom), 1 + n_randint(state, 15),
+        -(slong) n_randint(state, 8));
+}
+
+static void
+_random_point(arb_t x, const arb_t dom, flint_rand_t state)
+{
+    arf_set_mag(arb_midref(x), arb_radref(dom));
+    arf_mul_si(arb_midref(x), arb_midref(x),
+        (slong) n_randint(state, 2049) - 1024, ARF_PREC_EXACT, ARF_RND_DOWN);
+    arf_mul_2exp_si(arb_midref(x), arb_midref(x), -10);
+    arf_add(arb_midref(x), arb_midref(x), arb_midref(dom),
+        ARF_PREC_EXACT, ARF_RND_DOWN);
+    mag_zero(arb_radref(x));
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("add....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
+    {
+        arb_tmodel_t A, B, C;
+        arb_poly_t f, g;
+        arb_t dom, x, c, y, z, t;
+        slong prec;
+        int op;
+
+        arb_tmodel_init(A);
+        arb_tmodel_init(B);
+        arb_tmodel_init(C);
+        arb_poly_init(f);
+        arb_poly_init(g);
+        arb_init(dom);
+        arb_init(x);
+        arb_init(c);
+        arb_init(y);
+        arb_init(z);
+        arb_init(t);
+
+        prec = 2 + n_randint(state, 300);
+        op = n_randint(state, 5);
+
+        arb_poly_randtest(f, state, 1 + n_randint(state, 20), 1 + n_randint(state, 300), 5);
+        arb_poly_randtest(g, state, 1 + n_randint(state, 20), 1 + n_randint(state, 300), 5);
+        arb_randtest(c, state, 1 + n_randint(state, 300), 5);
+        _random_domain(dom, state);
+        _random_point(x, dom, state);
+
+        arb_tmodel_set_poly(A, f, dom, n_randint(state, 20), prec);
+        arb_tmodel_set_poly(B, g, dom, n_randint(state, 20), prec);
+
+        arb_poly_evaluate(y, f, x, prec);
+        arb_poly_evaluate(t, g, x, prec);
+
+        switch (op)
+        {
+            case 0:
+                arb_tmodel_add(C, A, B, prec);
+                arb_add(z, y, t, prec);
+                break;
+            case 1:
+                arb_tmodel_sub(C, A, B, prec);
+                arb_sub(z, y, t, prec);
+                break;
+            case 2:
+                arb_tmodel_neg(C, A);
+                arb_neg(z, y);
+                break;
+            case 3:
+                arb_tmodel_add_arb(C, A, c, prec);
+                arb_add(z, y, c, prec);
+                break;
+            default:
+                arb_tmodel_scalar_mul(C, A, c, prec);
+                arb_mul(z, y, c, prec);
+                break;
+        }
+
+        arb_tmodel_evaluate(y, C, x, prec);
+
+        if (!arb_overlaps(y, z))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("op = %d\n\n", op);
+            flint_printf("A = "); arb_tmodel_printd(A, 15); flint_printf("\n\n");
+            flint_printf("B = "); arb_tmodel_printd(B, 15); flint_printf("\n\n");
+            flint_printf("C = "); arb_tmodel_printd(C, 15); flint_printf("\n\n");
+            flint_printf("x = "); arb_printd(x, 15); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 15); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* check aliasing */
+        if (op == 0)
+        {
+            arb_tmodel_add(A, A, B, prec);
+
+            if (!arb_poly_equal(arb_tmodel_polyref(A), arb_tmodel_polyref(C))
+                || !mag_equal(arb_tmodel_errref(A), arb_tmodel_errref(C)))
+            {
+                flint_printf("FAIL (aliasing)\n\n");
+                flint_abort();
+            }
+        }
+
+        arb_tmodel_clear(A);
+        arb_tmodel_clear(B);
+        arb_tmodel_clear(C);
+        arb_poly_clear(f);
+        arb_poly_clear(g);
+        arb_clear(dom);
+        arb_clear(x);
+        arb_clear(c);
+        arb_clear(y);
+        arb_clear(z);
+        arb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
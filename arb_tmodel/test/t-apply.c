@@ -0,0 +1,198 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+static void
+_random_domain(arb_t dom, flint_rand_t state)
+{
+    arf_randtest(arb_midref(dom), state, 1 + n_randint(state, 100), 3);
+    mag_set_ui_2exp_si(arb_radref(dom), 1 + n_randint(state, 15),
+        -(slong) n_randint(state, 8));
+}
+static void
+_random_point(arb_t x, const arb_t dom, flint_rand_t state)
+{
+    arf_set_mag(arb_midref(x), arb_radref(dom));
+    arf_mul_si(arb_midref(x), arb_midref(x),
+        (slong) n_randint(state, 2049) - 1024, ARF_PREC_EXACT, ARF_RND_DOWN);
+    arf_mul_2exp_si(arb_midref(x), arb_midref(x), -10);
+    arf_add(arb_midref(x), arb_midref(x), arb_midref(dom),
+        ARF_PREC_EXACT, ARF_RND_DOWN);
+    mag_zero(arb_radref(x));
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("apply....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
+    {
+        arb_tmodel_t A, B, C;
+        arb_tmodel_srcptr S;
+        arb_poly_t f, g;
+        arb_t dom, x, y, z, t;
+        slong n, prec;
+        int op;
+
+        arb_tmodel_init(A);
+        arb_tmodel_init(B);
+        arb_tmodel_init(C);
+        arb_poly_init(f);
+        arb_poly_init(g);
+        arb_init(dom);
+        arb_init(x);
+        arb_init(y);
+        arb_init(z);
+        arb_init(t);
+
+        prec = 2 + n_randint(state, 300);
+        n = n_randint(state, 20);
+        op = n_randint(state, 9);
+
+        arb_poly_randtest(f, state, 1 + n_randint(state, 8), 1 + n_randint(state, 300), 2);
+        arb_poly_randtest(g, state, 1 + n_randint(state, 8), 1 + n_randint(state, 300), 2);
+        _random_domain(dom, state);
+        mag_mul_2exp_si(arb_radref(dom), arb_radref(dom), -4);
+        _random_point(x, dom, state);
+
+        arb_tmodel_set_poly(A, f, dom, n_randint(state, 10), prec);
+        arb_tmodel_set_poly(B, g, dom, n_randint(state, 10), prec);
+
+        arb_poly_evaluate(y, f, x, prec);
+
+        /* optionally test aliasing */
+        if (n_randint(state, 2))
+        {
+            arb_tmodel_set(C, A);
+            S = C;
+        }
+        else
+        {
+            S = A;
+        }
+
+        switch (op)
+        {
+            case 0:
+                arb_tmodel_exp(C, S, n, prec);
+                arb_exp(z, y, prec);
+                break;
+            case 1:
+                arb_tmodel_log(C, S, n, prec);
+                arb_log(z, y, prec);
+                break;
+            case 2:
+                arb_tmodel_sin(C, S, n, prec);
+                arb_sin(z, y, prec);
+                break;
+            case 3:
+                arb_tmodel_cos(C, S, n, prec);
+                arb_cos(z, y, prec);
+                break;
+            case 4:
+                arb_tmodel_atan(C, S, n, prec);
+                arb_atan(z, y, prec);
+                break;
+            case 5:
+                arb_tmodel_sqrt(C, S, n, prec);
+                arb_sqrt(z, y, prec);
+                break;
+            case 6:
+                arb_tmodel_rsqrt(C, S, n, prec);
+                arb_rsqrt(z, y, prec);
+                break;
+            case 7:
+                arb_tmodel_inv(C, S, n, prec);
+                arb_inv(z, y, prec);
+                break;
+            default:
+                arb_tmodel_div(C, S, B, n, prec);
+                arb_poly_evaluate(t, g, x, prec);
+                arb_div(z, y, t, prec);
+                break;
+        }
+
+        arb_tmodel_evaluate(y, C, x, prec);
+
+        if ((arb_is_finite(z) && !arb_overlaps(y, z))
+            || arb_tmodel_polyref(C)->length > n)
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("op = %d, n = %wd\n\n", op, n);
+            flint_printf("A = "); arb_tmodel_printd(A, 15); flint_printf("\n\n");
+            flint_printf("B = "); arb_tmodel_printd(B, 15); flint_printf("\n\n");
+            flint_printf("C = "); arb_tmodel_printd(C, 15); flint_printf("\n\n");
+            flint_printf("x = "); arb_printd(x, 15); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 15); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arb_tmodel_clear(A);
+        arb_tmodel_clear(B);
+        arb_tmodel_clear(C);
+        arb_poly_clear(f);
+        arb_poly_clear(g);
+        arb_clear(dom);
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(z);
+        arb_clear(t);
+    }
+
+    /* the model must actually be accurate: exp(x) on [-1/2, 1/2] */
+    {
+        arb_tmodel_t M;
+        arb_t dom, x, y, z;
+
+        arb_tmodel_init(M);
+        arb_init(dom);
+        arb_init(x);
+        arb_init(y);
+        arb_init(z);
+
+        mag_set_ui_2exp_si(arb_radref(dom), 1, -1);
+        arb_tmodel_set_var(M, dom);
+        arb_tmodel_exp(M, M, 40, 128);
+
+        arb_set_d(x, 0.25);
+        arb_tmodel_evaluate(y, M, x, 128);
+        arb_exp(z, x, 128);
+
+        if (!arb_overlaps(y, z) || arb_rel_accuracy_bits(y) < 100)
+        {
+            flint_printf("FAIL (accuracy)\n\n");
+            flint_printf("M = "); arb_tmodel_printd(M, 30); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 30); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arb_tmodel_clear(M);
+        arb_clear(dom);
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+static void
+_random_domain(arb_t dom, flint_rand_t state)
+{
+    arf_randtest(arb_midref(dom), state, 1 + n_randint(state, 100), 3);
+    mag_set_ui_2exp_si(arb_radref(dom), 1 + n_randint(state, 15),
+        -(slong) n_randint(state, 8));
+}
+
+static void
+_random_point(arb_t x, const arb_t dom, flint_rand_t state)
+{
+    arf_set_mag(arb_midref(x), arb_radref(dom));
+    arf_mul_si(arb_midref(x), arb_midref(x),
+        (slong) n_randint(state, 2049) - 1024, ARF_PREC_EXACT, ARF_RND_DOWN);
+    arf_mul_2exp_si(arb_midref(x), arb_midref(x), -10);
+    arf_add(arb_midref(x), arb_midref(x), arb_midref(dom),
+        ARF_PREC_EXACT, ARF_RND_DOWN);
+    mag_zero(arb_radref(x));
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("integral....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
+    {
+        arb_tmodel_t M, I;
+        arb_poly_t f, F;
+        arb_t dom, x, y, z, t;
+        slong n, prec;
+
+        arb_tmodel_init(M);
+        arb_tmodel_init(I);
+        arb_poly_init(f);
+        arb_poly_init(F);
+        arb_init(dom);
+        arb_init(x);
+        arb_init(y);
+        arb_init(z);
+        arb_init(t);
+
+        prec = 2 + n_randint(state, 300);
+        n = n_randint(state, 30);
+
+        arb_poly_randtest(f, state, 1 + n_randint(state, 30), 1 + n_randint(state, 300), 5);
+        _random_domain(dom, state);
+        _random_point(x, dom, state);
+
+        arb_tmodel_set_poly(M, f, dom, n_randint(state, 30), prec);
+        arb_poly_integral(F, f, prec);
+
+        /* indefinite integral from the midpoint */
+        arb_tmodel_integral(I, M, n, prec);
+        arb_tmodel_evaluate(y, I, x, prec);
+
+        arb_poly_evaluate(z, F, x, prec);
+        arf_set(arb_midref(t), arb_midref(dom));
+        arb_poly_evaluate(t, F, t, prec);
+        arb_sub(z, z, t, prec);
+
+        if (!arb_overlaps(y, z) || arb_tmodel_polyref(I)->length > n)
+        {
+            flint_printf("FAIL (indefinite)\n\n");
+            flint_printf("n = %wd\n\n", n);
+            flint_printf("M = "); arb_tmodel_printd(M, 15); flint_printf("\n\n");
+            flint_printf("I = "); arb_tmodel_printd(I, 15); flint_printf("\n\n");
+            flint_printf("x = "); arb_printd(x, 15); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 15); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* integral over the whole domain */
+        arb_tmodel_definite_integral(y, M, prec);
+
+        arb_zero(x);
+        arf_set_mag(arb_midref(x), arb_radref(dom));
+        arb_add_arf(t, x, arb_midref(dom), prec);
+        arb_poly_evaluate(z, F, t, prec);
+        arb_neg(x, x);
+        arb_add_arf(t, x, arb_midref(dom), prec);
+        arb_poly_evaluate(t, F, t, prec);
+        arb_sub(z, z, t, prec);
+
+        if (!arb_overlaps(y, z))
+        {
+            flint_printf("FAIL (definite)\n\n");
+            flint_printf("M = "); arb_tmodel_printd(M, 15); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 15); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arb_tmodel_clear(M);
+        arb_tmodel_clear(I);
+        arb_poly_clear(f);
+        arb_poly_clear(F);
+        arb_clear(dom);
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(z);
+        arb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,123 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+static void
+_random_domain(arb_t dom, flint_rand_t state)
+{
+    arf_randtest(arb_midref(dom), state, 1 + n_randint(state, 100), 3);
+    mag_set_ui_2exp_si(arb_radref(dom), 1 + n_randint(state, 15),
+        -(slong) n_randint(state, 8));
+}
+
+static void
+_random_point(arb_t x, const arb_t dom, flint_rand_t state)
+{
+    arf_set_mag(arb_midref(x), arb_radref(dom));
+    arf_mul_si(arb_midref(x), arb_midref(x),
+        (slong) n_randint(state, 2049) - 1024, ARF_PREC_EXACT, ARF_RND_DOWN);
+    arf_mul_2exp_si(arb_midref(x), arb_midref(x), -10);
+    arf_add(arb_midref(x), arb_midref(x), arb_midref(dom),
+        ARF_PREC_EXACT, ARF_RND_DOWN);
+    mag_zero(arb_radref(x));
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
+    {
+        arb_tmodel_t A, B, C;
+        arb_poly_t f, g;
+        arb_t dom, x, y, z, t;
+        slong n, prec;
+
+        arb_tmodel_init(A);
+        arb_tmodel_init(B);
+        arb_tmodel_init(C);
+        arb_poly_init(f);
+        arb_poly_init(g);
+        arb_init(dom);
+        arb_init(x);
+        arb_init(y);
+        arb_init(z);
+        arb_init(t);
+
+        prec = 2 + n_randint(state, 300);
+        n = n_randint(state, 30);
+
+        arb_poly_randtest(f, state, 1 + n_randint(state, 20), 1 + n_randint(state, 300), 5);
+        arb_poly_randtest(g, state, 1 + n_randint(state, 20), 1 + n_randint(state, 300), 5);
+        _random_domain(dom, state);
+        _random_point(x, dom, state);
+
+        arb_tmodel_set_poly(A, f, dom, n_randint(state, 20), prec);
+        arb_tmodel_set_poly(B, g, dom, n_randint(state, 20), prec);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                arb_tmodel_mul(C, A, B, n, prec);
+                break;
+            case 1:
+                arb_tmodel_set(C, A);
+                arb_tmodel_mul(C, C, B, n, prec);
+                break;
+            default:
+                arb_tmodel_set(C, B);
+                arb_tmodel_mul(C, A, C, n, prec);
+                break;
+        }
+
+        arb_poly_evaluate(y, f, x, prec);
+        arb_poly_evaluate(t, g, x, prec);
+        arb_mul(z, y, t, prec);
+        arb_tmodel_evaluate(y, C, x, prec);
+
+        if (!arb_overlaps(y, z) || arb_tmodel_polyref(C)->length > n)
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("n = %wd\n\n", n);
+            flint_printf("A = "); arb_tmodel_printd(A, 15); flint_printf("\n\n");
+            flint_printf("B = "); arb_tmodel_printd(B, 15); flint_printf("\n\n");
+            flint_printf("C = "); arb_tmodel_printd(C, 15); flint_printf("\n\n");
+            flint_printf("x = "); arb_printd(x, 15); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 15); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arb_tmodel_clear(A);
+        arb_tmodel_clear(B);
+        arb_tmodel_clear(C);
+        arb_poly_clear(f);
+        arb_poly_clear(g);
+        arb_clear(dom);
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(z);
+        arb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
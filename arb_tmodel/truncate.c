@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_tmodel.h"
+
+void
+arb_tmodel_truncate(arb_tmodel_t res, const arb_tmodel_t M, slong n)
+{
+    arb_poly_struct * P;
+    mag_t t, u;
+
+    arb_tmodel_set(res, M);
+
+    P = arb_tmodel_polyref(res);
+    n = FLINT_MAX(n, 0);
+
+    if (P->length <= n)
+        return;
+
+    mag_init(t);
+    mag_init(u);
+
+    /* sum_{k >= n} |c_k| |x - m|^k <= r^n sum_{k >= n} |c_k| r^(k-n) */
+    _arb_tmodel_poly_bound(t, P->coeffs + n, P->length - n,
+        arb_radref(arb_tmodel_domref(res)));
+    mag_pow_ui(u, arb_radref(arb_tmodel_domref(res)), n);
+    mag_mul(t, t, u);
+    mag_add(arb_tmodel_errref(res), arb_tmodel_errref(res), t);
+
+    arb_poly_truncate(P, n);
+
+    mag_clear(t);
+    mag_clear(u);
+}
+
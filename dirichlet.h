@@ -18,6 +18,7 @@
 #define DIRICHLET_INLINE static __inline__
 #endif
 
+#include <stdint.h>
 #include "dlog.h"
 
 #ifdef __cplusplus
@@ -168,6 +169,11 @@ void dirichlet_chi_vec_loop_order(ulong *v, const dirichlet_group_t G, const dir
 void dirichlet_chi_vec_primeloop_order(ulong *v, const dirichlet_group_t G, const dirichlet_char_t chi, ulong order, slong nv);
 void dirichlet_chi_vec_order(ulong *v, const dirichlet_group_t G, const dirichlet_char_t chi, ulong order, slong nv);
 
+#define DIRICHLET_CHI_NULL_32 UINT32_MAX
+
+void dirichlet_chi_vec_batch(uint32_t * v, const dirichlet_group_t G, const dirichlet_char_struct * chi, slong num, slong nv);
+void dirichlet_chi_vec_batch_order(uint32_t * v, const dirichlet_group_t G, const dirichlet_char_struct * chi, slong num, ulong order, slong nv);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,256 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "dirichlet.h"
+
+/* t = t + e mod order, for t, e < order, without overflow */
+#define ADDMOD32(t, e, order) \
+    ((t) >= (order) - (e) ? (t) - ((order) - (e)) : (t) + (e))
+
+/* e[k * num + i] = exponent of chi_i on the k-th generator, mod order */
+static void
+_dirichlet_chi_vec_batch_exponents(uint32_t * e, const dirichlet_group_t G,
+    const dirichlet_char_struct * chi, slong num, ulong order)
+{
+    slong i, k;
+    ulong mult = G->expo / order;
+
+    for (k = 0; k < G->num; k++)
+        for (i = 0; i < num; i++)
+            e[k * num + i] = (chi[i].log[k] * G->PHI[k]) / mult;
+}
+
+static void
+_dirichlet_chi_vec_batch_set_null(uint32_t * v, const dirichlet_group_t G,
+    slong num, slong nv)
+{
+    slong i, k, l;
+
+    for (i = 0; i < num; i++)
+    {
+        uint32_t * w = v + i * nv;
+
+        if (G->q_even > 1)
+            for (k = 2; k < nv; k += 2)
+                w[k] = DIRICHLET_CHI_NULL_32;
+
+        for (l = G->neven; l < G->num; l++)
+        {
+            ulong p = G->P[l].p;
+
+            for (k = p; k < nv; k += p)
+                w[k] = DIRICHLET_CHI_NULL_32;
+        }
+
+        if (G->q > 1 && nv > 0)
+            w[0] = DIRICHLET_CHI_NULL_32;
+    }
+}
+
+/* loop over the whole group, updating all characters at once */
+static void
+_dirichlet_chi_vec_batch_loop(uint32_t * v, const dirichlet_group_t G,
+    const dirichlet_char_struct * chi, slong num, ulong order, slong nv)
+{
+    int j;
+    slong i, k;
+    uint32_t * e, * t, o;
+    dirichlet_char_t x;
+
+    o = order;
+    e = flint_malloc(sizeof(uint32_t) * G->num * num);
+    t = flint_calloc(num, sizeof(uint32_t));
+
+    _dirichlet_chi_vec_batch_exponents(e, G, chi, num, order);
+
+    for (k = 0; k < num * nv; k++)
+        v[k] = DIRICHLET_CHI_NULL_32;
+
+    if (nv > 1)
+        for (i = 0; i < num; i++)
+            v[i * nv + 1] = 0;
+
+    dirichlet_char_init(x, G);
+    dirichlet_char_one(x, G);
+
+    while ((j = dirichlet_char_next(x, G)) >= 0)
+    {
+        /* exponents were modified up to j */
+        for (k = G->num - 1; k >= j; k--)
+        {
+            const uint32_t * ek = e + k * num;
+
+            for (i = 0; i < num; i++)
+                t[i] = ADDMOD32(t[i], ek[i], o);
+        }
+
+        if (x->n < nv)
+            for (i = 0; i < num; i++)
+                v[i * nv + x->n] = t[i];
+    }
+
+    /* copy outside modulus */
+    for (i = 0; i < num; i++)
+        for (k = G->q; k < nv; k++)
+            v[i * nv + k] = v[i * nv + k - G->q];
+
+    if (G->q == 1)
+        for (i = 0; i < num; i++)
+            for (k = 0; k < nv; k++)
+                v[i * nv + k] = 0;
+
+    dirichlet_char_clear(x);
+    flint_free(e);
+    flint_free(t);
+}
+
+/* w[n] = discrete log of n on the k-th component, for n < nv */
+static void
+_dirichlet_component_logs(ulong * w, const dirichlet_group_t G, slong k,
+    slong nv)
+{
+    const dirichlet_prime_group_struct * P = G->P + k;
+    slong n;
+
+    if (k < G->neven)
+    {
+        /* n = (-1)^a 5^b mod 2^e; component 0 gives a, component 1 gives b */
+        ulong * base, x, b, mask;
+
+        mask = P->pe.n - 1;
+        base = flint_malloc(sizeof(ulong) * P->pe.n);
+
+        for (n = 0; n < P->pe.n; n++)
+            base[n] = DLOG_NOT_FOUND;
+
+        if (k == 0)
+        {
+            for (n = 1; n < P->pe.n; n += 2)
+                base[n] = ((n & 3) == 3);
+        }
+        else
+        {
+            for (x = 1, b = 0; b < P->phi.n; b++)
+            {
+                base[x] = b;
+                base[P->pe.n - x] = b;
+                x = nmod_mul(x, 5, P->pe);
+            }
+        }
+
+        for (n = 0; n < nv; n++)
+            w[n] = base[n & mask];
+
+        flint_free(base);
+    }
+    else if (P->dlog == NULL)
+    {
+        dlog_vec(w, nv, P->g, 1, P->pe, P->phi.n, P->phi);
+    }
+    else
+    {
+        dlog_vec_sieve_precomp_threaded(w, nv, P->dlog, P->g, 1, P->pe, P->phi.n, P->phi);
+    }
+}
+
+/* one table of discrete logs per component, shared by all characters */
+static void
+_dirichlet_chi_vec_batch_primeloop(uint32_t * v, const dirichlet_group_t G,
+    const dirichlet_char_struct * chi, slong num, ulong order, slong nv)
+{
+    slong i, k, n;
+    ulong * w;
+    uint32_t * e, * tab, o;
+    nmod_t mod;
+
+    o = order;
+    nmod_init(&mod, order);
+
+    e = flint_malloc(sizeof(uint32_t) * G->num * num);
+    w = flint_malloc(sizeof(ulong) * nv);
+    tab = NULL;
+
+    _dirichlet_chi_vec_batch_exponents(e, G, chi, num, order);
+
+    for (n = 0; n < num * nv; n++)
+        v[n] = 0;
+
+    for (k = 0; k < G->num; k++)
+    {
+        ulong phi = G->P[k].phi.n;
+        int use_tab = (phi <= nv);
+
+        _dirichlet_component_logs(w, G, k, nv);
+
+        if (use_tab)
+            tab = flint_realloc(tab, sizeof(uint32_t) * phi);
+
+        for (i = 0; i < num; i++)
+        {
+            uint32_t c = e[k * num + i];
+            uint32_t * vi = v + i * nv;
+
+            if (c == 0)
+                continue;
+
+            if (use_tab)
+            {
+                /* tab[a] = a c mod order */
+                tab[0] = 0;
+                for (n = 1; n < phi; n++)
+                    tab[n] = ADDMOD32(tab[n - 1], c, o);
+
+                for (n = 0; n < nv; n++)
+                    if (w[n] != DLOG_NOT_FOUND)
+                        vi[n] = ADDMOD32(vi[n], tab[w[n]], o);
+            }
+            else
+            {
+                for (n = 0; n < nv; n++)
+                    if (w[n] != DLOG_NOT_FOUND)
+                        vi[n] = ADDMOD32(vi[n],
+                            (uint32_t) nmod_mul(c, w[n], mod), o);
+            }
+        }
+    }
+
+    _dirichlet_chi_vec_batch_set_null(v, G, num, nv);
+
+    flint_free(e);
+    flint_free(w);
+    flint_free(tab);
+}
+
+void
+dirichlet_chi_vec_batch_order(uint32_t * v, const dirichlet_group_t G,
+    const dirichlet_char_struct * chi, slong num, ulong order, slong nv)
+{
+    if (num <= 0 || nv <= 0)
+        return;
+
+    if (order >= DIRICHLET_CHI_NULL_32)
+    {
+        flint_printf("dirichlet_chi_vec_batch: order %wu does not fit in 32 bits\n", order);
+        flint_abort();
+    }
+
+    if (2 * nv > G->phi_q)
+        _dirichlet_chi_vec_batch_loop(v, G, chi, num, order, nv);
+    else
+        _dirichlet_chi_vec_batch_primeloop(v, G, chi, num, order, nv);
+}
+
+void
+dirichlet_chi_vec_batch(uint32_t * v, const dirichlet_group_t G,
+    const dirichlet_char_struct * chi, slong num, slong nv)
+{
+    dirichlet_chi_vec_batch_order(v, G, chi, num, G->expo, nv);
+}
@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "dirichlet.h"
+#include "arb.h" /* for test_multiplier */
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_batch....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 3000 * arb_test_multiplier(); iter++)
+    {
+        dirichlet_group_t G;
+        dirichlet_char_struct * chi;
+        uint32_t * v;
+        ulong * ref, q, order;
+        slong i, k, num, nv;
+
+        q = 2 + n_randint(state, (iter < 1000) ? 100 : 3000);
+        nv = n_randint(state, 2 * q + 10);
+
+        dirichlet_group_init(G, q);
+
+        if (n_randint(state, 4) == 0)
+            dirichlet_group_dlog_precompute(G, 1 + n_randint(state, 50));
+
+        num = 1 + n_randint(state, 10);
+        chi = flint_malloc(sizeof(dirichlet_char_struct) * num);
+
+        for (i = 0; i < num; i++)
+        {
+            dirichlet_char_init(chi + i, G);
+            dirichlet_char_index(chi + i, G, n_randint(state, G->phi_q));
+        }
+
+        if (num == 1 && n_randint(state, 2))
+            order = dirichlet_order_char(G, chi);
+        else
+            order = G->expo;
+
+        v = flint_malloc(sizeof(uint32_t) * num * nv + 1);
+        ref = flint_malloc(sizeof(ulong) * nv + 1);
+
+        dirichlet_chi_vec_batch_order(v, G, chi, num, order, nv);
+
+        for (i = 0; i < num; i++)
+        {
+            dirichlet_chi_vec_order(ref, G, chi + i, order, nv);
+
+            for (k = 1; k < nv; k++)
+            {
+                ulong r = ref[k];
+                ulong c = v[i * nv + k];
+
+                if (c == DIRICHLET_CHI_NULL_32)
+                    c = DIRICHLET_CHI_NULL;
+
+                /* chi_vec_loop leaves no value at multiples of q */
+                if (G->q > 1 && n_gcd(k, G->q) > 1)
+                    r = DIRICHLET_CHI_NULL;
+
+                if (r != c)
+                {
+                    flint_printf("FAIL: chi_%wu(%wu,%wd) [mod %wu]\n",
+                        q, chi[i].n, k, order);
+                    flint_printf("nv = %wd, num = %wd, i = %wd\n", nv, num, i);
+                    flint_printf("vec       -> %wu\n", r);
+                    flint_printf("vec_batch -> %wu\n", c);
+                    flint_abort();
+                }
+            }
+        }
+
+        for (i = 0; i < num; i++)
+            dirichlet_char_clear(chi + i);
+        flint_free(chi);
+        flint_free(v);
+        flint_free(ref);
+        dirichlet_group_dlog_clear(G);
+        dirichlet_group_clear(G);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
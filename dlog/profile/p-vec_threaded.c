@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "dlog.h"
+#include "profiler.h"
+
+#define NPRIMES 4
+
+int main()
+{
+    int i, ni = 4;
+    int bits[4] = { 20, 30, 40, 50 };
+
+    int j, nj = 3;
+    ulong * v;
+    ulong nv[3] = { 100000, 1000000, 10000000 };
+
+    int t, nt = 4;
+    int threads[4] = { 1, 2, 4, 8 };
+
+    int k;
+    nmod_t p[NPRIMES];
+    ulong a[NPRIMES];
+
+    flint_rand_t state;
+    nmod_t order;
+
+    nmod_init(&order, 100);
+    flint_randinit(state);
+
+    for (i = 0; i < ni; i++)
+    {
+        for (k = 0; k < NPRIMES; k++)
+        {
+            nmod_init(&p[k], n_randprime(state, bits[i], 0));
+            a[k] = n_primitive_root_prime(p[k].n);
+        }
+
+        for (j = 0; j < nj; j++)
+        {
+            if (nv[j] > p[0].n)
+                continue;
+
+            v = flint_malloc(nv[j] * sizeof(ulong));
+
+            flint_printf("log(1..%wu) mod %d primes of size %d bits....\n", nv[j], NPRIMES, bits[i]);
+            fflush(stdout);
+
+            flint_printf("%-20s...   ", "sieve");
+            fflush(stdout);
+
+            TIMEIT_ONCE_START
+            for (k = 0; k < NPRIMES; k++)
+                dlog_vec_sieve(v, nv[j], a[k], 1, p[k], p[k].n - 1, order);
+            TIMEIT_ONCE_STOP
+
+            for (t = 0; t < nt; t++)
+            {
+                flint_set_num_threads(threads[t]);
+
+                flint_printf("threaded (%d)%-8s...   ", threads[t], "");
+                fflush(stdout);
+
+                TIMEIT_ONCE_START
+                for (k = 0; k < NPRIMES; k++)
+                    dlog_vec_sieve_threaded(v, nv[j], a[k], 1, p[k], p[k].n - 1, order);
+                TIMEIT_ONCE_STOP
+            }
+
+            flint_set_num_threads(1);
+            flint_free(v);
+        }
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "dlog.h"
+#include "arb.h" /* for test_multiplier */
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_sieve_threaded....");
+    fflush(stdout);
+    flint_randinit(state);
+
+    for (iter = 0; iter < 20 * arb_test_multiplier(); iter++)
+    {
+        ulong * v, * ref;
+        ulong k, p, q, a, na, nv, bits;
+        nmod_t mod, order;
+        dlog_precomp_t pre;
+
+        bits = 10 + n_randint(state, FLINT_MIN(26, FLINT_BITS - 10));
+        p = n_randprime(state, bits, 0);
+        a = n_primitive_root_prime(p);
+
+        /* squares of primes have a prime factor in the range */
+        if (n_randint(state, 4) == 0 && bits <= 16)
+        {
+            q = p * p;
+            if (n_powmod(a, p - 1, q) == 1)
+                a += p;
+            na = p * (p - 1);
+            dlog_precomp_modpe_init(pre, a, p, 2, q, 50);
+            p = q;
+        }
+        else
+        {
+            na = p - 1;
+            dlog_precomp_n_init(pre, a, p, na, 50);
+        }
+
+        nmod_init(&mod, p);
+        nmod_init(&order, na);
+
+        nv = 1 + n_randint(state, 250000);
+
+        ref = flint_malloc(nv * sizeof(ulong));
+        v = flint_malloc(nv * sizeof(ulong));
+
+        dlog_vec_fill(ref, nv, 0);
+        dlog_vec_sieve_precomp(ref, nv, pre, a, 1, mod, na, order);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        dlog_vec_fill(v, nv, 0);
+        dlog_vec_sieve_precomp_threaded(v, nv, pre, a, 1, mod, na, order);
+
+        for (k = 1; k < nv; k++)
+        {
+            if (v[k] != ref[k])
+            {
+                flint_printf("FAIL: log(%wu,%wu) mod %wu: sieve->%wu != threaded->%wu\n",
+                        k, a, p, ref[k], v[k]);
+                flint_abort();
+            }
+        }
+
+        dlog_precomp_clear(pre);
+        flint_free(ref);
+        flint_free(v);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -19,5 +19,5 @@ dlog_vec(ulong *v, ulong nv, ulong a, ulong va, nmod_t mod, ulong na, nmod_t ord
     if (na * DLOG_LOOP_MAX_FACTOR < nv)
         dlog_vec_loop(v, nv, a, va, mod, na, order);
     else
-        dlog_vec_sieve(v, nv, a, va, mod, na, order);
+        dlog_vec_sieve_threaded(v, nv, a, va, mod, na, order);
 }
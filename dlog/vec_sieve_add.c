@@ -17,7 +17,7 @@ dlog_vec_sieve_add(ulong *v, ulong nv, ulong a, ulong va, nmod_t mod, ulong na,
     ulong * w, k;
     /* store size */
     w = flint_malloc(nv * sizeof(ulong));
-    dlog_vec_sieve(w, nv, a, va, mod, na, order);
+    dlog_vec_sieve_threaded(w, nv, a, va, mod, na, order);
     /* write in v */
     for (k = 0; k < nv; k++)
         if (v[k] != DLOG_NOT_FOUND)
@@ -17,7 +17,7 @@ dlog_vec_sieve_add_precomp(ulong *v, ulong nv, dlog_precomp_t pre, ulong a, ulon
     ulong * w, k;
     /* store size */
     w = flint_malloc(nv * sizeof(ulong));
-    dlog_vec_sieve_precomp(w, nv, pre, a, va, mod, na, order);
+    dlog_vec_sieve_precomp_threaded(w, nv, pre, a, va, mod, na, order);
     /* write in v */
     for (k = 0; k < nv; k++)
         if (v[k] != DLOG_NOT_FOUND)
@@ -0,0 +1,246 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <math.h>
+#include "dlog.h"
+
+/* length of a segment of [1, n); v and the cofactors of one segment
+   should fit in the L2 cache */
+#define DLOG_VEC_SIEVE_BLOCK 16384
+
+typedef struct
+{
+    ulong * v;
+    const ulong * primes;
+    slong num_primes;
+    dlog_precomp_struct * pre;
+    ulong lo;
+    ulong hi;
+    slong start;
+    slong step;
+    ulong aX;
+    ulong vaX;
+    ulong va;
+    nmod_t mod;
+    ulong na;
+    ulong logm1;
+    nmod_t order;
+}
+dlog_vec_sieve_arg_t;
+
+/* logarithm of a prime p > sqrt(n), knowing all v[k] for k < lo */
+static ulong
+_dlog_vec_sieve_prime(const dlog_vec_sieve_arg_t * arg, ulong p)
+{
+    double cost;
+    ulong vp;
+
+    cost = log(arg->mod.n) / log(p);
+    cost = pow(cost, cost);
+
+    if (arg->pre->cost < cost || (vp = dlog_vec_pindex_factorgcd(arg->v,
+            arg->lo, p, arg->mod, arg->aX, arg->na, arg->vaX, arg->logm1,
+            arg->order, cost)) == DLOG_NOT_FOUND)
+        vp = nmod_mul(dlog_precomp(arg->pre, p), arg->va, arg->order);
+
+    return vp;
+}
+
+/* fill v[lo..hi); every k in the block has at most one prime factor q
+   outside the factor base, and q < lo unless q = k */
+static void
+_dlog_vec_sieve_block(const dlog_vec_sieve_arg_t * arg, ulong * cof,
+    ulong lo, ulong hi)
+{
+    ulong * v = arg->v;
+    ulong k, p, pk, q, vp;
+    slong i;
+
+    for (k = lo; k < hi; k++)
+    {
+        v[k] = 0;
+        cof[k - lo] = 1;
+    }
+
+    for (i = 0; i < arg->num_primes; i++)
+    {
+        p = arg->primes[i];
+
+        if (arg->mod.n % p == 0)
+        {
+            for (k = ((lo + p - 1) / p) * p; k < hi; k += p)
+                v[k] = DLOG_NOT_FOUND;
+            continue;
+        }
+
+        vp = v[p];
+
+        for (pk = p; ; pk *= p)
+        {
+            for (k = ((lo + pk - 1) / pk) * pk; k < hi; k += pk)
+            {
+                if (v[k] == DLOG_NOT_FOUND)
+                    continue;
+                v[k] = nmod_add(v[k], vp, arg->order);
+                cof[k - lo] *= p;
+            }
+
+            if (pk > (hi - 1) / p)
+                break;
+        }
+    }
+
+    for (k = lo; k < hi; k++)
+    {
+        if (v[k] == DLOG_NOT_FOUND || cof[k - lo] == k)
+            continue;
+
+        q = k / cof[k - lo];
+
+        if (q == k)
+        {
+            if (arg->mod.n % q == 0)
+                v[k] = DLOG_NOT_FOUND;
+            else
+                v[k] = _dlog_vec_sieve_prime(arg, q);
+        }
+        else if (v[q] == DLOG_NOT_FOUND)
+            v[k] = DLOG_NOT_FOUND;
+        else
+            v[k] = nmod_add(v[k], v[q], arg->order);
+    }
+}
+
+static void
+_dlog_vec_sieve_blocks(const dlog_vec_sieve_arg_t * arg)
+{
+    ulong * cof, lo, hi;
+    slong c;
+
+    cof = flint_malloc(sizeof(ulong) * DLOG_VEC_SIEVE_BLOCK);
+
+    for (c = arg->start; ; c += arg->step)
+    {
+        if (c >= (arg->hi - arg->lo + DLOG_VEC_SIEVE_BLOCK - 1) / DLOG_VEC_SIEVE_BLOCK)
+            break;
+
+        lo = arg->lo + c * DLOG_VEC_SIEVE_BLOCK;
+        hi = FLINT_MIN(lo + DLOG_VEC_SIEVE_BLOCK, arg->hi);
+
+        _dlog_vec_sieve_block(arg, cof, lo, hi);
+    }
+
+    flint_free(cof);
+}
+
+static void *
+_dlog_vec_sieve_worker(void * arg_ptr)
+{
+    _dlog_vec_sieve_blocks((dlog_vec_sieve_arg_t *) arg_ptr);
+
+    flint_cleanup();
+
+    return NULL;
+}
+
+void
+dlog_vec_sieve_precomp_threaded(ulong *v, ulong nv, dlog_precomp_t pre, ulong a, ulong va, nmod_t mod, ulong na, nmod_t order)
+{
+    ulong k, n, r, p, lo, hi, X;
+    ulong * primes;
+    slong i, num_primes, num_blocks, num_threads;
+    n_primes_t iter;
+    pthread_t * threads;
+    dlog_vec_sieve_arg_t * args;
+
+    n = FLINT_MIN(nv, mod.n);
+
+    if (n < 4 * DLOG_VEC_SIEVE_BLOCK)
+    {
+        dlog_vec_sieve_precomp(v, nv, pre, a, va, mod, na, order);
+        return;
+    }
+
+    /* logarithms below sqrt(n) by the serial sieve; they contain
+       the logarithms of the factor base */
+    r = n_sqrt(n - 1);
+    dlog_vec_sieve_precomp(v, r + 1, pre, a, va, mod, na, order);
+
+    primes = flint_malloc(sizeof(ulong) * (r / 2 + 2));
+    num_primes = 0;
+    n_primes_init(iter);
+    while ((p = n_primes_next(iter)) <= r)
+        primes[num_primes++] = p;
+    n_primes_clear(iter);
+
+    num_threads = flint_get_num_threads();
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(dlog_vec_sieve_arg_t) * num_threads);
+
+    X = n_nextprime(3 * na / 2, 0) % na;
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].v = v;
+        args[i].primes = primes;
+        args[i].num_primes = num_primes;
+        args[i].pre = pre;
+        args[i].start = i;
+        args[i].aX = nmod_pow_ui(a, X, mod);
+        args[i].vaX = nmod_mul(va, X % order.n, order);
+        args[i].va = va;
+        args[i].mod = mod;
+        args[i].na = na;
+        args[i].logm1 = (na % 2) ? 0 : nmod_mul(na / 2, va, order);
+        args[i].order = order;
+    }
+
+    /* process [lo, 2 lo) in waves: the large prime factor of a
+       composite k lies below k / 2, hence in an earlier wave */
+    for (lo = r + 1; lo < n; lo = hi)
+    {
+        hi = (lo > n / 2) ? n : 2 * lo;
+        num_blocks = (hi - lo + DLOG_VEC_SIEVE_BLOCK - 1) / DLOG_VEC_SIEVE_BLOCK;
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].lo = lo;
+            args[i].hi = hi;
+            args[i].step = FLINT_MIN(num_threads, num_blocks);
+        }
+
+        if (num_threads <= 1 || num_blocks == 1)
+        {
+            _dlog_vec_sieve_blocks(&args[0]);
+        }
+        else
+        {
+            for (i = 0; i < FLINT_MIN(num_threads, num_blocks); i++)
+                pthread_create(&threads[i], NULL,
+                    _dlog_vec_sieve_worker, &args[i]);
+
+            for (i = 0; i < FLINT_MIN(num_threads, num_blocks); i++)
+                pthread_join(threads[i], NULL);
+        }
+    }
+
+    flint_free(threads);
+    flint_free(args);
+    flint_free(primes);
+
+    if (nv > mod.n)
+    {
+        v[mod.n] = DLOG_NOT_FOUND;
+        for (k = mod.n + 1; k < nv; k++)
+            v[k] = v[k - mod.n];
+    }
+}
@@ -50,6 +50,19 @@ slong hypgeom_estimate_terms(const mag_t z, int r, slong prec);
 slong hypgeom_bound(mag_t error, int r,
     slong C, slong D, slong K, const mag_t TK, const mag_t z, slong prec);
 
+ARB_DLL extern slong hypgeom_bsplit_threaded_cutoff;
+
+typedef void (*hypgeom_bsplit_basecase_func_t)(void * res, slong a, slong b, void * args);
+typedef void (*hypgeom_bsplit_merge_func_t)(void * res, void * right, void * args);
+typedef void (*hypgeom_bsplit_init_func_t)(void * x, void * args);
+typedef void (*hypgeom_bsplit_clear_func_t)(void * x, void * args);
+
+void hypgeom_parallel_binary_splitting(void * res,
+    hypgeom_bsplit_basecase_func_t basecase, hypgeom_bsplit_merge_func_t merge,
+    size_t sizeof_res, hypgeom_bsplit_init_func_t init,
+    hypgeom_bsplit_clear_func_t clear, void * args,
+    slong a, slong b, slong basecase_cutoff, slong num_threads);
+
 void arb_hypgeom_sum(arb_t P, arb_t Q, const hypgeom_t hyp, slong n, slong prec);
 
 void arb_hypgeom_infsum(arb_t P, arb_t Q, hypgeom_t hyp, slong target_prec, slong prec);
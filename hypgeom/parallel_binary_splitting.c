@@ -0,0 +1,120 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "hypgeom.h"
+
+typedef struct
+{
+    hypgeom_bsplit_basecase_func_t basecase;
+    hypgeom_bsplit_merge_func_t merge;
+    size_t sizeof_res;
+    hypgeom_bsplit_init_func_t init;
+    hypgeom_bsplit_clear_func_t clear;
+    void * args;
+    slong basecase_cutoff;
+}
+bsplit_ctx_t;
+
+typedef struct
+{
+    const bsplit_ctx_t * ctx;
+    void * res;
+    slong a;
+    slong b;
+    slong num_threads;
+}
+bsplit_arg_t;
+
+static void _hypgeom_bsplit_rec(void * res, const bsplit_ctx_t * ctx,
+    slong a, slong b, slong num_threads);
+
+static void *
+bsplit_worker(void * arg_ptr)
+{
+    bsplit_arg_t arg = *((bsplit_arg_t *) arg_ptr);
+    _hypgeom_bsplit_rec(arg.res, arg.ctx, arg.a, arg.b, arg.num_threads);
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    The right half of the range is evaluated in a new thread while the
+    calling thread does the left half; the available threads are
+    split between the two halves, so that at most num_threads
+    leaves are evaluated simultaneously.
+*/
+static void
+_hypgeom_bsplit_rec(void * res, const bsplit_ctx_t * ctx,
+    slong a, slong b, slong num_threads)
+{
+    if (num_threads <= 1 || b - a <= ctx->basecase_cutoff)
+    {
+        ctx->basecase(res, a, b, ctx->args);
+    }
+    else
+    {
+        pthread_t thread;
+        bsplit_arg_t arg;
+        void * right;
+        slong m;
+
+        m = a + (b - a) / 2;
+
+        right = flint_malloc(ctx->sizeof_res);
+        ctx->init(right, ctx->args);
+
+        arg.ctx = ctx;
+        arg.res = right;
+        arg.a = m;
+        arg.b = b;
+        arg.num_threads = num_threads / 2;
+
+        pthread_create(&thread, NULL, bsplit_worker, &arg);
+        _hypgeom_bsplit_rec(res, ctx, a, m, num_threads - num_threads / 2);
+        pthread_join(thread, NULL);
+
+        ctx->merge(res, right, ctx->args);
+
+        ctx->clear(right, ctx->args);
+        flint_free(right);
+    }
+}
+
+void
+hypgeom_parallel_binary_splitting(void * res,
+    hypgeom_bsplit_basecase_func_t basecase, hypgeom_bsplit_merge_func_t merge,
+    size_t sizeof_res, hypgeom_bsplit_init_func_t init,
+    hypgeom_bsplit_clear_func_t clear, void * args,
+    slong a, slong b, slong basecase_cutoff, slong num_threads)
+{
+    bsplit_ctx_t ctx;
+
+    if (b <= a)
+    {
+        flint_printf("hypgeom_parallel_binary_splitting: empty range\n");
+        flint_abort();
+    }
+
+    ctx.basecase = basecase;
+    ctx.merge = merge;
+    ctx.sizeof_res = sizeof_res;
+    ctx.init = init;
+    ctx.clear = clear;
+    ctx.args = args;
+    ctx.basecase_cutoff = FLINT_MAX(basecase_cutoff, 1);
+
+    if (num_threads <= 0)
+        num_threads = flint_get_num_threads();
+
+    _hypgeom_bsplit_rec(res, &ctx, a, b, num_threads);
+}
+
@@ -11,6 +11,8 @@
 
 #include "hypgeom.h"
 
+ARB_DLL slong hypgeom_bsplit_threaded_cutoff = 4096;
+
 static __inline__ void
 fmpz_poly_evaluate_si(fmpz_t y, const fmpz_poly_t poly, slong x)
 {
@@ -144,6 +146,84 @@ bsplit_recursive_arb(arb_t P, arb_t Q, arb_t B, arb_t T,
     }
 }
 
+typedef struct
+{
+    arb_t P;
+    arb_t Q;
+    arb_t B;
+    arb_t T;
+    slong b;
+}
+bsplit_res_t;
+
+typedef struct
+{
+    const hypgeom_struct * hyp;
+    slong n;
+    slong prec;
+}
+bsplit_args_t;
+
+static void
+bsplit_init(void * x, void * args)
+{
+    bsplit_res_t * r = x;
+    arb_init(r->P);
+    arb_init(r->Q);
+    arb_init(r->B);
+    arb_init(r->T);
+    r->b = 0;
+}
+
+static void
+bsplit_clear(void * x, void * args)
+{
+    bsplit_res_t * r = x;
+    arb_clear(r->P);
+    arb_clear(r->Q);
+    arb_clear(r->B);
+    arb_clear(r->T);
+}
+
+static void
+bsplit_basecase(void * x, slong a, slong b, void * args)
+{
+    bsplit_res_t * r = x;
+    bsplit_args_t * s = args;
+
+    bsplit_recursive_arb(r->P, r->Q, r->B, r->T, s->hyp, a, b, b != s->n, s->prec);
+    r->b = b;
+}
+
+static void
+bsplit_merge(void * x, void * y, void * args)
+{
+    bsplit_res_t * r = x;
+    bsplit_res_t * r2 = y;
+    slong prec = ((bsplit_args_t *) args)->prec;
+    int cont = r2->b != ((bsplit_args_t *) args)->n;
+
+    if (arb_is_one(r->B) && arb_is_one(r2->B))
+    {
+        arb_mul(r->T, r->T, r2->Q, prec);
+        arb_addmul(r->T, r->P, r2->T, prec);
+    }
+    else
+    {
+        arb_mul(r->T, r->T, r2->B, prec);
+        arb_mul(r->T, r->T, r2->Q, prec);
+        arb_mul(r2->T, r2->T, r->B, prec);
+        arb_addmul(r->T, r->P, r2->T, prec);
+    }
+
+    arb_mul(r->B, r->B, r2->B, prec);
+    arb_mul(r->Q, r->Q, r2->Q, prec);
+    if (cont)
+        arb_mul(r->P, r->P, r2->P, prec);
+
+    r->b = r2->b;
+}
+
 void
 arb_hypgeom_sum(arb_t P, arb_t Q, const hypgeom_t hyp, slong n, slong prec)
 {
@@ -152,6 +232,29 @@ arb_hypgeom_sum(arb_t P, arb_t Q, const hypgeom_t hyp, slong n, slong prec)
         arb_zero(P);
         arb_one(Q);
     }
+    else if (flint_get_num_threads() > 1 && n >= 64
+        && prec >= hypgeom_bsplit_threaded_cutoff)
+    {
+        bsplit_res_t r;
+        bsplit_args_t args;
+
+        args.hyp = hyp;
+        args.n = n;
+        args.prec = prec;
+
+        bsplit_init(&r, &args);
+        hypgeom_parallel_binary_splitting(&r, bsplit_basecase, bsplit_merge,
+            sizeof(bsplit_res_t), bsplit_init, bsplit_clear, &args,
+            0, n, 16, -1);
+
+        if (!arb_is_one(r.B))
+            arb_mul(Q, r.Q, r.B, prec);
+        else
+            arb_swap(Q, r.Q);
+        arb_swap(P, r.T);
+
+        bsplit_clear(&r, &args);
+    }
     else
     {
         arb_t B, T;
@@ -0,0 +1,111 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "hypgeom.h"
+
+static void
+_fmpz_poly_randtest_nonneg(fmpz_poly_t poly, flint_rand_t state, slong len)
+{
+    slong i;
+
+    fmpz_poly_zero(poly);
+
+    for (i = 0; i < len; i++)
+        fmpz_poly_set_coeff_ui(poly, i, n_randint(state, 20));
+
+    fmpz_poly_set_coeff_ui(poly, len - 1, 1 + n_randint(state, 20));
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("sum_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* exercise the threaded code at small precision */
+    hypgeom_bsplit_threaded_cutoff = 0;
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        hypgeom_t hyp;
+        arb_t P1, Q1, P2, Q2, s1, s2;
+        slong n, prec;
+
+        hypgeom_init(hyp);
+        arb_init(P1);
+        arb_init(Q1);
+        arb_init(P2);
+        arb_init(Q2);
+        arb_init(s1);
+        arb_init(s2);
+
+        /* coefficients are nonnegative with a positive leading term,
+           so that Q(k) does not vanish for k >= 1; B(0) is also used */
+        _fmpz_poly_randtest_nonneg(hyp->A, state, 1 + n_randint(state, 3));
+        _fmpz_poly_randtest_nonneg(hyp->B, state, 1 + n_randint(state, 3));
+        fmpz_poly_set_coeff_ui(hyp->B, 0, 1 + n_randint(state, 20));
+        _fmpz_poly_randtest_nonneg(hyp->P, state, 1 + n_randint(state, 3));
+        _fmpz_poly_randtest_nonneg(hyp->Q, state, 1 + n_randint(state, 3));
+
+        n = n_randint(state, 500);
+        /* at high precision, all products are computed exactly */
+        if (n_randint(state, 4) == 0)
+            prec = 30000;
+        else
+            prec = 2 + n_randint(state, 2000);
+
+        flint_set_num_threads(1);
+        arb_hypgeom_sum(P1, Q1, hyp, n, prec);
+
+        flint_set_num_threads(2 + n_randint(state, 6));
+        arb_hypgeom_sum(P2, Q2, hyp, n, prec);
+
+        arb_div(s1, P1, Q1, prec);
+        arb_div(s2, P2, Q2, prec);
+
+        /* both are exact when the precision is large enough, and then
+           the threaded merge must give the same integers */
+        if (!arb_overlaps(s1, s2) ||
+            (arb_is_exact(P1) && arb_is_exact(Q1) &&
+             arb_is_exact(P2) && arb_is_exact(Q2) &&
+             (!arb_equal(P1, P2) || !arb_equal(Q1, Q2))))
+        {
+            flint_printf("FAIL (iter = %wd)\n\n", iter);
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_printf("A = "); fmpz_poly_print(hyp->A); flint_printf("\n");
+            flint_printf("B = "); fmpz_poly_print(hyp->B); flint_printf("\n");
+            flint_printf("P = "); fmpz_poly_print(hyp->P); flint_printf("\n");
+            flint_printf("Q = "); fmpz_poly_print(hyp->Q); flint_printf("\n\n");
+            flint_printf("P1 = "); arb_printd(P1, 30); flint_printf("\n\n");
+            flint_printf("Q1 = "); arb_printd(Q1, 30); flint_printf("\n\n");
+            flint_printf("P2 = "); arb_printd(P2, 30); flint_printf("\n\n");
+            flint_printf("Q2 = "); arb_printd(Q2, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        hypgeom_clear(hyp);
+        arb_clear(P1);
+        arb_clear(Q1);
+        arb_clear(P2);
+        arb_clear(Q2);
+        arb_clear(s1);
+        arb_clear(s2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}